@@ -293,8 +293,8 @@ public:
       rel(*this, start[i*m+m-1] + spec.duration(i,m-1) <= makespan);
     }
   }
-  /// Do not overload machines
-  void nooverload(void) {
+  /// Do not overload machines, using timetable-edge-finding if \a ttef
+  void nooverload(bool ttef=false) {
     // Number of jobs and machines/steps
     int n = spec.jobs(), m = spec.machines();
 
@@ -313,7 +313,10 @@ public:
       for (int i=0; i<n; i++) {
         jpm[i] = jobs[j*n+i]; dpm[i] = dur[j*n+i];
       }
-      unary(*this, jpm, dpm);
+      if (ttef)
+        cumulative(*this, 1, jpm, dpm, IntArgs::create(n,1,0), IPL_BASIC_ADVANCED);
+      else
+        unary(*this, jpm, dpm);
     }
   }
   /// Return cost
@@ -459,15 +462,16 @@ public:
   /// Propagation to use
   enum {
     PROP_ORDER, ///< Only propagate order constraints
-    PROP_UNARY  ///< Also post unary constraints
+    PROP_UNARY, ///< Also post unary constraints
+    PROP_TTEF   ///< Also post cumulative constraints with timetable-edge-finding
   };
   /// Actual model
   JobShopSolve(const JobShopOptions& o)
     : JobShopBase(o),
       sorder(*this, spec.machines()*spec.jobs()*(spec.jobs()-1)/2, 0, 1),
       rnd(o.seed()) {
-    if (opt.propagation() == PROP_UNARY)
-      nooverload();
+    if (opt.propagation() != PROP_ORDER)
+      nooverload(opt.propagation() == PROP_TTEF);
 
     // Number of jobs and machines/steps
     int n = spec.jobs(), m = spec.machines();
@@ -809,6 +813,7 @@ main(int argc, char* argv[]) {
   opt.propagation(JobShopSolve::PROP_UNARY);
   opt.propagation(JobShopSolve::PROP_ORDER,"order");
   opt.propagation(JobShopSolve::PROP_UNARY,"unary");
+  opt.propagation(JobShopSolve::PROP_TTEF,"ttef");
 
   opt.instance("ft06");
 
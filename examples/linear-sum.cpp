@@ -0,0 +1,107 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/driver.hh>
+#include <gecode/int.hh>
+#include <gecode/minimodel.hh>
+
+using namespace Gecode;
+
+/**
+ * \brief %Example: Large linear sums
+ *
+ * The model has size variables with values between 0 and 9 that
+ * must sum up to 5 times size, while a capacity row with random
+ * coefficients between 1 and 10 bounds their weighted sum. Search
+ * assigns the variables in order to their maximal values, so that
+ * each decision changes a single term of both linear constraints.
+ *
+ * The example serves as a benchmark for linear propagators with
+ * many terms: if no size is given, it sweeps the number of terms
+ * from 10 to 100000.
+ *
+ * \ingroup Example
+ */
+class LinearSum : public Script {
+protected:
+  /// The variables
+  IntVarArray x;
+public:
+  /// Actual model
+  LinearSum(const SizeOptions& opt)
+    : Script(opt), x(*this,static_cast<int>(opt.size()),0,9) {
+    Rnd r(opt.seed());
+    int n = x.size();
+    IntArgs a(n);
+    long long int s = 0;
+    for (int i=0; i<n; i++) {
+      a[i] = 1 + static_cast<int>(r(10U));
+      s += a[i];
+    }
+    linear(*this, x, IRT_EQ, 5*n);
+    linear(*this, a, x, IRT_LQ, static_cast<int>(6*s));
+    branch(*this, x, INT_VAR_NONE(), INT_VAL_MAX());
+  }
+  /// Constructor for cloning \a s
+  LinearSum(LinearSum& s) : Script(s) {
+    x.update(*this, s.x);
+  }
+  /// Copy during cloning
+  virtual Space*
+  copy(void) {
+    return new LinearSum(*this);
+  }
+  /// Print solution
+  virtual void
+  print(std::ostream& os) const {
+    int n = 0;
+    for (int i=0; i<x.size(); i++)
+      n += x[i].val();
+    os << "\tterms: " << x.size() << ", sum: " << n << std::endl;
+  }
+};
+
+/** \brief Main-function
+ *  \relates LinearSum
+ */
+int
+main(int argc, char* argv[]) {
+  SizeOptions opt("LinearSum");
+  opt.size(0);
+  opt.parse(argc,argv);
+  if (opt.size() > 0) {
+    Script::run<LinearSum,DFS,SizeOptions>(opt);
+  } else {
+    for (unsigned int n=10; n<=100000; n *= 10) {
+      opt.size(n);
+      Script::run<LinearSum,DFS,SizeOptions>(opt);
+    }
+  }
+  return 0;
+}
+
+// STATISTICS: example-any
@@ -175,11 +175,46 @@ const int* specs[] = {
 const unsigned int n_specs = sizeof(specs) / sizeof(int*);
 //@}
 
+/**
+ * \brief %Options for %PerfectSquare problems
+ *
+ */
+class PerfectSquareOptions : public SizeOptions {
+protected:
+  /// Number of copies of the master square along each side
+  Driver::UnsignedIntOption _copies;
+public:
+  /// Initialize options for example with name \a s
+  PerfectSquareOptions(const char* s)
+    : SizeOptions(s),
+      _copies("copies",
+              "copies of master square along each side (0: scale from 1 to 5)",
+              1) {
+    add(_copies);
+  }
+  /// Return number of copies along each side
+  unsigned int copies(void) const {
+    return _copies.value();
+  }
+  /// Set number of copies along each side to \a c
+  void copies(unsigned int c) {
+    _copies.value(c);
+  }
+};
+
 /**
  * \brief %Example: Packing squares into a rectangle
  *
  * See problem 9 at http://www.csplib.org/.
  *
+ * The option \c copies packs the squares of that many copies of the
+ * master square along each side into a square that is as many times
+ * larger, where each copy is placed and searched for in its own part.
+ * As the number of squares grows quadratically with the number of
+ * copies while all of them take part in a single no-overlap
+ * constraint, the example serves as a scaling benchmark for that
+ * constraint: with \c copies set to 0 it is run for 1 to 5 copies.
+ *
  * \ingroup Example
  */
 class PerfectSquare : public Script {
@@ -195,78 +230,91 @@ public:
     PROP_CUMULATIVES ///< Use cumulatives constraint
   };
   /// Actual model
-  PerfectSquare(const SizeOptions& opt)
+  PerfectSquare(const PerfectSquareOptions& opt)
     : Script(opt),
-      x(*this,specs[opt.size()][0],0,specs[opt.size()][1]-1),
-      y(*this,specs[opt.size()][0],0,specs[opt.size()][1]-1) {
+      x(*this,opt.copies()*opt.copies()*specs[opt.size()][0],
+        0,opt.copies()*specs[opt.size()][1]-1),
+      y(*this,opt.copies()*opt.copies()*specs[opt.size()][0],
+        0,opt.copies()*specs[opt.size()][1]-1) {
 
     const int* s = specs[opt.size()];
+    int k = static_cast<int>(opt.copies());
     int n = *s++;
     int w = *s++;
 
-    // Restrict position according to square size
-    for (int i=0; i<n; i++) {
-      rel(*this, x[i], IRT_LQ, w-s[i]);
-      rel(*this, y[i], IRT_LQ, w-s[i]);
-    }
-
-    IntArgs sa(n,s);
+    // Sizes of the squares for all copies of the master square
+    IntArgs sa(k*k*n);
+    for (int i=0; i<k*k*n; i++)
+      sa[i] = s[i % n];
 
     // Squares do not overlap
     nooverlap(*this, x, sa, y, sa);
 
-    /*
-     * Capacity constraints
-     *
-     */
-    switch (opt.propagation()) {
-    case PROP_REIFIED:
-      {
-        for (int cx=0; cx<w; cx++) {
-          BoolVarArgs bx(*this,n,0,1);
-          for (int i=0; i<n; i++)
-            dom(*this, x[i], cx-s[i]+1, cx, bx[i]);
-          linear(*this, sa, bx, IRT_EQ, w);
-        }
-        for (int cy=0; cy<w; cy++) {
-          BoolVarArgs by(*this,n,0,1);
-          for (int i=0; i<n; i++)
-            dom(*this, y[i], cy-s[i]+1, cy, by[i]);
-          linear(*this, sa, by, IRT_EQ, w);
-        }
+    for (int c=0; c<k*k; c++) {
+      // Squares of this copy and the origin of its part
+      IntVarArgs xc(x.slice(c*n,1,n)), yc(y.slice(c*n,1,n));
+      int ox = (c % k) * w, oy = (c / k) * w;
+
+      // Restrict position according to square size
+      for (int i=0; i<n; i++) {
+        dom(*this, xc[i], ox, ox+w-s[i]);
+        dom(*this, yc[i], oy, oy+w-s[i]);
       }
-      break;
-    case PROP_CUMULATIVES:
-      {
-        IntArgs m(n), dh(n);
-        for (int i=0; i<n; i++) {
-          m[i]=0; dh[i]=s[i];
-        }
-        IntArgs limit({w});
+
+      /*
+       * Capacity constraints
+       *
+       */
+      switch (opt.propagation()) {
+      case PROP_REIFIED:
         {
-          // x-direction
-          IntVarArgs e(n);
-          for (int i=0; i<n; i++)
-            e[i]=expr(*this, x[i]+dh[i]);
-          cumulatives(*this, m, x, dh, e, dh, limit, true);
-          cumulatives(*this, m, x, dh, e, dh, limit, false);
+          IntArgs sc(n,s);
+          for (int cx=ox; cx<ox+w; cx++) {
+            BoolVarArgs bx(*this,n,0,1);
+            for (int i=0; i<n; i++)
+              dom(*this, xc[i], cx-s[i]+1, cx, bx[i]);
+            linear(*this, sc, bx, IRT_EQ, w);
+          }
+          for (int cy=oy; cy<oy+w; cy++) {
+            BoolVarArgs by(*this,n,0,1);
+            for (int i=0; i<n; i++)
+              dom(*this, yc[i], cy-s[i]+1, cy, by[i]);
+            linear(*this, sc, by, IRT_EQ, w);
+          }
         }
+        break;
+      case PROP_CUMULATIVES:
         {
-          // y-direction
-          IntVarArgs e(n);
-          for (int i=0; i<n; i++)
-            e[i]=expr(*this, y[i]+dh[i]);
-          cumulatives(*this, m, y, dh, e, dh, limit, true);
-          cumulatives(*this, m, y, dh, e, dh, limit, false);
+          IntArgs m(n), dh(n);
+          for (int i=0; i<n; i++) {
+            m[i]=0; dh[i]=s[i];
+          }
+          IntArgs limit({w});
+          {
+            // x-direction
+            IntVarArgs e(n);
+            for (int i=0; i<n; i++)
+              e[i]=expr(*this, xc[i]+dh[i]);
+            cumulatives(*this, m, xc, dh, e, dh, limit, true);
+            cumulatives(*this, m, xc, dh, e, dh, limit, false);
+          }
+          {
+            // y-direction
+            IntVarArgs e(n);
+            for (int i=0; i<n; i++)
+              e[i]=expr(*this, yc[i]+dh[i]);
+            cumulatives(*this, m, yc, dh, e, dh, limit, true);
+            cumulatives(*this, m, yc, dh, e, dh, limit, false);
+          }
         }
+        break;
+      default:
+        GECODE_NEVER;
       }
-      break;
-    default:
-      GECODE_NEVER;
-    }
 
-    branch(*this, x, INT_VAR_MIN_MIN(), INT_VAL_MIN());
-    branch(*this, y, INT_VAR_MIN_MIN(), INT_VAL_MIN());
+      branch(*this, xc, INT_VAR_MIN_MIN(), INT_VAL_MIN());
+      branch(*this, yc, INT_VAR_MIN_MIN(), INT_VAL_MIN());
+    }
   }
 
   /// Constructor for cloning \a s
@@ -294,7 +342,7 @@ public:
  */
 int
 main(int argc, char* argv[]) {
-  SizeOptions opt("PerfectSquare");
+  PerfectSquareOptions opt("PerfectSquare");
   opt.propagation(PerfectSquare::PROP_REIFIED);
   opt.propagation(PerfectSquare::PROP_REIFIED,     "reified");
   opt.propagation(PerfectSquare::PROP_CUMULATIVES, "cumulatives");
@@ -306,7 +354,14 @@ main(int argc, char* argv[]) {
               << std::endl;
     return 1;
   }
-  Script::run<PerfectSquare,DFS,SizeOptions>(opt);
+  if (opt.copies() > 0) {
+    Script::run<PerfectSquare,DFS,PerfectSquareOptions>(opt);
+  } else {
+    for (unsigned int k=1; k<=5; k++) {
+      opt.copies(k);
+      Script::run<PerfectSquare,DFS,PerfectSquareOptions>(opt);
+    }
+  }
   return 0;
 }
 
@@ -0,0 +1,142 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/driver.hh>
+#include <gecode/int.hh>
+#include <gecode/int/extensional.hh>
+
+using namespace Gecode;
+
+/// Options for random tables
+class RandomTableOptions : public SizeOptions {
+protected:
+  Driver::UnsignedIntOption _vars;   ///< Number of variables
+  Driver::UnsignedIntOption _values; ///< Number of values
+  Driver::UnsignedIntOption _arity;  ///< Arity of tables
+public:
+  /// Initialize options for example with name \a s
+  RandomTableOptions(const char* s)
+    : SizeOptions(s),
+      _vars("vars","number of variables",24),
+      _values("values","number of values per variable",16),
+      _arity("arity","arity of tables",5) {
+    add(_vars); add(_values); add(_arity);
+  }
+  /// Return number of variables
+  int vars(void) const { return static_cast<int>(_vars.value()); }
+  /// Return number of values
+  int values(void) const { return static_cast<int>(_values.value()); }
+  /// Return arity of tables
+  int arity(void) const { return static_cast<int>(_arity.value()); }
+};
+
+/**
+ * \brief %Example: Random tables
+ *
+ * Variables are constrained by table constraints on overlapping
+ * windows of consecutive variables, each table consists of size
+ * randomly generated tuples. The model serves as a benchmark for
+ * the compact-table propagator on large tuple sets: the model
+ * selects whether the bit-set operations are performed by the
+ * scalar or the vectorized (AVX2) kernels.
+ *
+ * \ingroup Example
+ */
+class RandomTable : public Script {
+protected:
+  /// The variables
+  IntVarArray x;
+public:
+  /// Kernel used for bit-set operations
+  enum {
+    MODEL_SCALAR, ///< Use scalar kernels
+    MODEL_AVX2    ///< Use AVX2 kernels (if supported)
+  };
+  /// Actual model
+  RandomTable(const RandomTableOptions& opt)
+    : Script(opt), x(*this,opt.vars(),0,opt.values()-1) {
+    Rnd r(opt.seed());
+    int a = opt.arity();
+    for (int i=0; i+a <= x.size(); i += a-1) {
+      TupleSet t(a);
+      IntArgs tuple(a);
+      for (unsigned int n=0; n<opt.size(); n++) {
+        for (int j=0; j<a; j++)
+          tuple[j] = static_cast<int>(r(opt.values()));
+        t.add(tuple);
+      }
+      t.finalize();
+      IntVarArgs y(a);
+      for (int j=0; j<a; j++)
+        y[j] = x[i+j];
+      extensional(*this, y, t);
+    }
+    branch(*this, x, INT_VAR_SIZE_MIN(), INT_VAL_MIN());
+  }
+  /// Constructor for cloning \a s
+  RandomTable(RandomTable& s) : Script(s) {
+    x.update(*this, s.x);
+  }
+  /// Copy during cloning
+  virtual Space*
+  copy(void) {
+    return new RandomTable(*this);
+  }
+  /// Print solution
+  virtual void
+  print(std::ostream& os) const {
+    os << "\t" << x << std::endl;
+  }
+};
+
+/** \brief Main-function
+ *  \relates RandomTable
+ */
+int
+main(int argc, char* argv[]) {
+  RandomTableOptions opt("RandomTable");
+  opt.size(100000);
+  opt.model(RandomTable::MODEL_AVX2);
+  opt.model(RandomTable::MODEL_SCALAR, "scalar", "use scalar bit-set kernels");
+  opt.model(RandomTable::MODEL_AVX2, "avx2", "use AVX2 bit-set kernels");
+  opt.parse(argc,argv);
+  if (opt.arity() < 2) {
+    std::cerr << "arity must be at least 2!" << std::endl;
+    return 1;
+  }
+  Int::Extensional::BitSetKernel k =
+    Int::Extensional::bitset_kernel
+    ((opt.model() == RandomTable::MODEL_AVX2) ?
+     Int::Extensional::BSK_AVX2 : Int::Extensional::BSK_SCALAR);
+  std::cout << "Bit-set kernel: "
+            << ((k == Int::Extensional::BSK_AVX2) ? "avx2" : "scalar")
+            << std::endl;
+  Script::run<RandomTable,DFS,RandomTableOptions>(opt);
+  return 0;
+}
+
+// STATISTICS: example-any
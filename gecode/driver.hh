@@ -444,6 +444,7 @@ namespace Gecode {
                               _r_limit;       ///< Cutoff for number of restarts 
     Driver::BoolOption        _nogoods;       ///< Whether to use no-goods
     Driver::UnsignedIntOption _nogoods_limit; ///< Limit for no-good extraction
+    Driver::UnsignedIntOption _nogoods_learn; ///< Limit for no-good learning
     Driver::DoubleOption      _relax;         ///< Probability to relax variable
     Driver::BoolOption        _interrupt;     ///< Whether to catch SIGINT
     //@}
@@ -608,6 +609,11 @@ namespace Gecode {
     /// Return depth limit for nogoods
     unsigned int nogoods_limit(void) const;
 
+    /// Set default depth limit for learning nogoods from failures
+    void nogoods_learn(unsigned int l);
+    /// Return depth limit for learning nogoods from failures
+    unsigned int nogoods_learn(void) const;
+
     /// Set default relax probability
     void relax(double d);
     /// Return default relax probability
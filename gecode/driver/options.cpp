@@ -641,6 +641,9 @@ namespace Gecode {
       _nogoods("nogoods","whether to use no-goods from restarts",false),
       _nogoods_limit("nogoods-limit","depth limit for no-good extraction",
                      Search::Config::nogoods_limit),
+      _nogoods_learn("nogoods-learn",
+                     "depth limit for learning no-goods from failures "
+                     "(0 = none)",0),
       _relax("relax","probability for relaxing variable", 0.0),
       _interrupt("interrupt","whether to catch Ctrl-C (true) or not (false)",
                  true),
@@ -681,7 +684,7 @@ namespace Gecode {
     add(_node); add(_fail); add(_time); add(_interrupt);
     add(_assets); add(_slice);
     add(_restart); add(_r_base); add(_r_scale); add(_r_limit);
-    add(_nogoods); add(_nogoods_limit);
+    add(_nogoods); add(_nogoods_limit); add(_nogoods_learn);
     add(_relax);
     add(_mode); add(_iterations); add(_samples); add(_print_last);
     add(_out_file); add(_log_file); add(_trace);
@@ -452,6 +452,15 @@ namespace Gecode {
     return _nogoods_limit.value();
   }
 
+  inline void
+  Options::nogoods_learn(unsigned int l) {
+    _nogoods_learn.value(l);
+  }
+  inline unsigned int
+  Options::nogoods_learn(void) const {
+    return _nogoods_learn.value();
+  }
+
   inline void
   Options::relax(double d) {
     _relax.value(d);
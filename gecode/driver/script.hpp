@@ -480,6 +480,7 @@ namespace Gecode { namespace Driver {
           so.cutoff  = createCutoff(o);
           so.clone   = false;
           so.nogoods_limit = o.nogoods() ? o.nogoods_limit() : 0U;
+          so.nogoods_learn = o.nogoods_learn();
           if (o.interrupt())
             CombinedStop::installCtrlHandler(true);
           {
@@ -582,6 +583,7 @@ namespace Gecode { namespace Driver {
                                             o.interrupt());
           so.cutoff  = createCutoff(o);
           so.nogoods_limit = o.nogoods() ? o.nogoods_limit() : 0U;
+          so.nogoods_learn = o.nogoods_learn();
           if (o.interrupt())
             CombinedStop::installCtrlHandler(true);
           {
@@ -644,6 +646,7 @@ namespace Gecode { namespace Driver {
                                                  false);
               sok.cutoff  = createCutoff(o);
               sok.nogoods_limit = o.nogoods() ? o.nogoods_limit() : 0U;
+              sok.nogoods_learn = o.nogoods_learn();
               {
                 Meta<Script,Engine> e(s1,sok);
                 do {
@@ -242,6 +242,7 @@ namespace Gecode { namespace FlatZinc {
       Gecode::Driver::DoubleOption      _threads;   ///< How many threads to use
       Gecode::Driver::BoolOption        _free; ///< Use free search
       Gecode::Driver::DoubleOption      _decay;       ///< Decay option
+      Gecode::Driver::UnsignedIntOption _afc_merge;   ///< Merge frequency for AFC and CHB
       Gecode::Driver::UnsignedIntOption _c_d;       ///< Copy recomputation distance
       Gecode::Driver::UnsignedIntOption _a_d;       ///< Adaptive recomputation distance
       Gecode::Driver::UnsignedLongLongIntOption _node;      ///< Cutoff for number of nodes
@@ -255,6 +256,7 @@ namespace Gecode { namespace FlatZinc {
       Gecode::Driver::UnsignedLongLongIntOption _r_limit; ///< Cutoff for number of restarts 
       Gecode::Driver::BoolOption        _nogoods;   ///< Whether to use no-goods
       Gecode::Driver::UnsignedIntOption _nogoods_limit; ///< Depth limit for extracting no-goods
+      Gecode::Driver::UnsignedIntOption _nogoods_learn; ///< Depth limit for learning no-goods
       Gecode::Driver::BoolOption        _interrupt; ///< Whether to catch SIGINT
       Gecode::Driver::DoubleOption      _step;        ///< Step option
       Gecode::Driver::BoolOption        _use_pbs; //< Whether to use PBS or default BAB ADDED
@@ -283,6 +285,7 @@ namespace Gecode { namespace FlatZinc {
                Gecode::Search::Config::threads),
       _free("f", "free search, no need to follow search-specification"),
       _decay("decay","decay factor",0.99),
+      _afc_merge("afc-merge","merge AFC and CHB information after this many failures (0 = automatic)",0),
       _c_d("c-d","recomputation commit distance",Gecode::Search::Config::c_d),
       _a_d("a-d","recomputation adaption distance",Gecode::Search::Config::a_d),
       _node("node","node cutoff (0 = none, solution mode)"),
@@ -297,11 +300,14 @@ namespace Gecode { namespace FlatZinc {
       _nogoods("nogoods","whether to use no-goods from restarts",false),
       _nogoods_limit("nogoods-limit","depth limit for no-good extraction",
                      Search::Config::nogoods_limit),
+      _nogoods_learn("nogoods-learn",
+                     "depth limit for learning no-goods from failures "
+                     "(0 = none)",0),
       _interrupt("interrupt","whether to catch Ctrl-C (true) or not (false)",
                  true),
       _step("step","step distance for float optimization",0.0),
       _use_pbs("use-pbs", "whether to use portfolio-based-search or not", false), // ADDED
-      _full_s("full-s", "whether to print statistics of all assets", false), // ADDED
+      _full_s("full-s", "whether to print statistics of all assets and the memory footprint", false), // ADDED
       _assets("assets","the number of assets to use with portfolio-based search", 8), // ADDED
 
       _mode("mode","how to execute script",Gecode::SM_SOLUTION),
@@ -325,12 +331,12 @@ namespace Gecode { namespace FlatZinc {
       add(_solutions); add(_threads); add(_c_d); add(_a_d);
       add(_allSolutions);
       add(_free);
-      add(_decay);
+      add(_decay); add(_afc_merge);
       add(_node); add(_fail); add(_time); add(_time_limit); add(_interrupt);
       add(_seed);
       add(_step);
       add(_restart); add(_r_base); add(_r_scale); add(_r_limit);
-      add(_nogoods); add(_nogoods_limit);
+      add(_nogoods); add(_nogoods_limit); add(_nogoods_learn);
       add(_mode); add(_stat); add(_use_pbs); add(_full_s); add(_assets);
       add(_output); 
 #ifdef GECODE_HAS_CPPROFILER
@@ -377,6 +383,12 @@ namespace Gecode { namespace FlatZinc {
     }
 
     double decay(void) const { return _decay.value(); }
+    /// Return merge frequency for AFC and CHB, choosing one when automatic
+    unsigned int afc_merge(bool parallel) const {
+      if (_afc_merge.value() > 0)
+        return _afc_merge.value();
+      return parallel ? 32U : 1U;
+    }
     RestartMode restart(void) const {
       return static_cast<RestartMode>(_restart.value());
     }
@@ -390,6 +402,7 @@ namespace Gecode { namespace FlatZinc {
     unsigned long long int restart_limit(void) const { return _r_limit.value(); }
     bool nogoods(void) const { return _nogoods.value(); }
     unsigned int nogoods_limit(void) const { return _nogoods_limit.value(); }
+    unsigned int nogoods_learn(void) const { return _nogoods_learn.value(); }
     bool interrupt(void) const { return _interrupt.value(); }
 
 #ifdef GECODE_HAS_CPPROFILER
@@ -741,6 +754,10 @@ namespace Gecode { namespace FlatZinc {
     virtual Gecode::Space* copy(void);
     /// Slave function for restarts
     virtual bool slave(const MetaInfo& mi);
+    /// Add memory footprint including variables and shared objects to \a mf
+    virtual void footprint(MemoryFootprint& mf);
+    /// Print memory footprint as statistics on \a out
+    void printFootprint(std::ostream& out);
 
     /// \name AST to variable and value conversion
     //@{
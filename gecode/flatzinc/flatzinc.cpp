@@ -2348,6 +2348,7 @@ namespace Gecode { namespace FlatZinc {
 #endif
     o.threads = opt.threads();
     o.nogoods_limit = opt.nogoods() ? opt.nogoods_limit() : 0;
+    o.nogoods_learn = opt.nogoods_learn();
     o.cutoff  = new Search::CutoffAppend(new Search::CutoffConstant(0), 1, Driver::createCutoff(opt));
     if (opt.interrupt())
       Driver::CombinedStop::installCtrlHandler(true);
@@ -2409,6 +2410,8 @@ namespace Gecode { namespace FlatZinc {
             << "%%%mzn-stat: peakDepth=" << stat.depth << std::endl
             << "%%%mzn-stat-end" << std::endl
             << std::endl;
+        if (opt.fullStatistics())
+          printFootprint(out);
       }
     }
     delete o.stop;
@@ -2459,6 +2462,7 @@ namespace Gecode { namespace FlatZinc {
     this->postConstraints(constraints, false);
     this->createBranchers(p, this->solveAnnotations(), opt, false, bm);
     this->shrinkArrays(p);
+    afc_merge(opt.afc_merge(opt.threads() != 1.0));
 
     switch (_method) {
     case MIN:
@@ -2473,6 +2477,8 @@ namespace Gecode { namespace FlatZinc {
 
   void FlatZincSpace::runPBS(std::ostream& out, FlatZinc::Printer& p, FlatZincOptions& opt, Support::Timer& t_total, const int assets) {
     PBSController pbs(this, assets, p);
+    // Assets search in parallel on clones sharing AFC and CHB information
+    afc_merge(opt.afc_merge(true));
     switch (_method) {
     case MIN:
     case MAX:
@@ -2798,6 +2804,116 @@ namespace Gecode { namespace FlatZinc {
     return _optVarIsInt;
   }
 
+  namespace {
+
+    /// Add variable implementation \a x of type \a t with \a b bytes to \a mf
+    void footprintVar(MemoryFootprint& mf, std::unordered_set<const void*>& seen,
+                      const void* x, const char* t, size_t b) {
+      if ((x != nullptr) && seen.insert(x).second)
+        MemoryFootprint::add(mf.variables, t, b);
+    }
+
+    /// Return number of ranges of iterator \a i
+    template<class I>
+    unsigned int footprintRanges(I& i) {
+      unsigned int n = 0;
+      for (; i(); ++i)
+        n++;
+      return n;
+    }
+
+  }
+
+  void
+  FlatZincSpace::footprint(MemoryFootprint& mf) {
+    Space::footprint(mf);
+    // Variables might occur in several arrays, count each only once
+    std::unordered_set<const void*> seen;
+    IntVarArray ia[] = {iv, iv_aux};
+    for (IntVarArray& a : ia)
+      for (int i=0; i<a.size(); i++) {
+        if (a[i].varimp() == nullptr)
+          continue;
+        IntVarRanges r(a[i]);
+        unsigned int n = footprintRanges(r);
+        footprintVar(mf, seen, a[i].varimp(), "IntVar",
+                     sizeof(Int::IntVarImp) +
+                     ((n > 1) ? n*sizeof(Gecode::RangeList) : 0));
+      }
+    BoolVarArray ba[] = {bv, bv_aux};
+    for (BoolVarArray& a : ba)
+      for (int i=0; i<a.size(); i++)
+        footprintVar(mf, seen, a[i].varimp(), "BoolVar",
+                     sizeof(Int::BoolVarImp));
+#ifdef GECODE_HAS_SET_VARS
+    SetVarArray sa[] = {sv, sv_aux};
+    for (SetVarArray& a : sa)
+      for (int i=0; i<a.size(); i++) {
+        if (a[i].varimp() == nullptr)
+          continue;
+        SetVarGlbRanges glb(a[i]);
+        SetVarLubRanges lub(a[i]);
+        unsigned int n = footprintRanges(glb) + footprintRanges(lub);
+        footprintVar(mf, seen, a[i].varimp(), "SetVar",
+                     sizeof(Set::SetVarImp) + n*sizeof(Gecode::RangeList));
+      }
+#endif
+#ifdef GECODE_HAS_FLOAT_VARS
+    FloatVarArray fa[] = {fv, fv_aux};
+    for (FloatVarArray& a : fa)
+      for (int i=0; i<a.size(); i++)
+        footprintVar(mf, seen, a[i].varimp(), "FloatVar",
+                     sizeof(Float::FloatVarImp));
+#endif
+    // Shared objects are only known while the model is being set up
+    if (_initData) {
+      for (const TupleSet& ts : _initData->tupleSetSet) {
+        size_t b = static_cast<size_t>(ts.tuples()) * ts.arity() * sizeof(int);
+        for (int i=0; i<ts.arity(); i++)
+          for (TupleSet::Ranges r(ts,i); r(); ++r)
+            b += sizeof(TupleSet::Range) +
+              static_cast<size_t>(r.width()) * ts.words() *
+              sizeof(TupleSet::BitSetData);
+        MemoryFootprint::add(mf.shared, "TupleSet", b);
+      }
+      for (const SharedArray<int>& sa : _initData->intSharedArraySet)
+        MemoryFootprint::add(mf.shared, "SharedArray<int>",
+                             static_cast<size_t>(sa.size()) * sizeof(int));
+      for (const DFA& d : _initData->dfaSet)
+        MemoryFootprint::add(mf.shared, "DFA",
+                             static_cast<size_t>(d.n_transitions()) *
+                             sizeof(DFA::Transition));
+    }
+  }
+
+  void
+  FlatZincSpace::printFootprint(std::ostream& out) {
+    if (status() == SS_FAILED)
+      return;
+    MemoryFootprint mf;
+    footprint(mf);
+    out << "%%%mzn-stat: memoryHeap=" << mf.heap << std::endl
+        << "%%%mzn-stat: memorySubscriptions=" << mf.subscriptions << std::endl
+        << "%%%mzn-stat: memoryPropagators="
+        << MemoryFootprint::bytes(mf.propagators) << std::endl
+        << "%%%mzn-stat: memoryBranchers="
+        << MemoryFootprint::bytes(mf.branchers) << std::endl
+        << "%%%mzn-stat: memoryVariables="
+        << MemoryFootprint::bytes(mf.variables) << std::endl
+        << "%%%mzn-stat: memoryShared="
+        << MemoryFootprint::bytes(mf.shared) << std::endl;
+    std::pair<const char*,const MemoryFootprint::Entries*> es[] = {
+      {"Propagator", &mf.propagators}, {"Brancher", &mf.branchers},
+      {"Variable", &mf.variables}, {"Shared", &mf.shared}
+    };
+    for (const auto& e : es)
+      for (const auto& i : *e.second)
+        out << "%%%mzn-stat: memory" << e.first << "=\"" << i.first
+            << ": n=" << i.second.n << ", bytes=" << i.second.bytes
+            << "\"" << std::endl;
+    out << "%%%mzn-stat-end" << std::endl;
+  }
+
   void
   FlatZincSpace::print(std::ostream& out, const Printer& p) const {
     p.print(out, iv, bv
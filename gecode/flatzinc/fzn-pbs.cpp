@@ -150,6 +150,8 @@ void PBSController::solutionStatistics(BaseAsset* asset, std::ostream& out, Supp
         for (long unsigned int i = 0; i < asset_num_sols.size(); i++){
             out << "%%%mzn-stat: asset " << assets[i]->getAssetTypeStr() << " found " << asset_num_sols[i] << " solutions." << endl;
         }
+        // Memory footprint of the root space, every asset holds a clone of it.
+        fg->printFootprint(out);
     }
     else{
         out << std::endl
@@ -706,6 +708,7 @@ void DFSAsset::setupAsset(){
 
     search_options.threads = threads;
     search_options.nogoods_limit = fopt.nogoods() ? fopt.nogoods_limit() : 0;
+    search_options.nogoods_learn = fopt.nogoods_learn();
 
     if (fopt.restart() != RM_NONE){
         fopt.restart(RM_NONE);
@@ -747,6 +750,7 @@ void LNSAsset::setupAsset(){
 
     search_options.threads = threads;
     search_options.nogoods_limit = fopt.nogoods() ? fopt.nogoods_limit() : 0;
+    search_options.nogoods_learn = fopt.nogoods_learn();
 
     fzs->setLNSType(lns_type);
     if (lns_type == FlatZinc::FlatZincSpace::LNSType::CIG){
@@ -33,11 +33,14 @@ LNSstrategies::~LNSstrategies() {
 
 bool LNSstrategies::random(FlatZincSpace& fzs, MetaInfo mi, std::atomic<FlatZincSpace*>* global_best_sol, IntSharedArray& initialSolution, unsigned int lns, int* iv_lns_default_idx, int idx_size, IntVarArgs iv_lns, bool use_iv_lns, Rnd random) {
     if ((mi.type() == MetaInfo::RESTART) && (mi.restart() != 0) && (lns > 0) && (mi.last()==nullptr) && (initialSolution.size()>0)) {
+      // Collect the variables to be fixed and fix them in one go.
+      IntVarArgs fix; IntArgs val;
       for (unsigned int i=iv_lns.size(); i--;) {
         if (random(99U) <= lns) {
-          rel(fzs, iv_lns[i], IRT_EQ, initialSolution[i]);
+          fix << iv_lns[i]; val << initialSolution[i];
         }
       }
+      dom(fzs, fix, val);
       return false;
 
     } 
@@ -54,20 +57,22 @@ bool LNSstrategies::random(FlatZincSpace& fzs, MetaInfo mi, std::atomic<FlatZinc
       }
       
 
+      IntVarArgs fix; IntArgs val;
       if (use_iv_lns){
         for (unsigned int i=iv_lns.size(); i--;) {
           if (random(99U) <= lns) {
-            rel(fzs, iv_lns[i], IRT_EQ, lastPtr->iv_lns[i].val());
+            fix << iv_lns[i]; val << lastPtr->iv_lns[i].val();
           }
         }
       }
       if (!use_iv_lns){
         for (int i=0; i < idx_size; i++) {
           if (random(99U) <= lns) {
-            rel(fzs, fzs.iv[iv_lns_default_idx[i]], IRT_EQ, lastPtr->iv[iv_lns_default_idx[i]].val());
+            fix << fzs.iv[iv_lns_default_idx[i]]; val << lastPtr->iv[iv_lns_default_idx[i]].val();
           }
         }
       }
+      dom(fzs, fix, val);
 
       return false;
     }
@@ -242,14 +247,16 @@ bool LNSstrategies::reversedPropagationGuided(FlatZincSpace& fzs, MetaInfo mi, s
 bool LNSstrategies::objectiveRelaxation(FlatZincSpace& fzs, MetaInfo mi, std::atomic<FlatZincSpace*>* global_best_sol, unsigned int lns, int* iv_lns_obj_relax_idx, int idx_size, Rnd random){
   if ((mi.type() == MetaInfo::RESTART) && (mi.restart() != 0) && (lns > 0) && global_best_sol != nullptr && global_best_sol->load() != nullptr) {
     const FlatZincSpace& last = static_cast<const FlatZincSpace&>(*global_best_sol->load());
+    IntVarArgs fix; IntArgs val;
     for (int i=0; i < idx_size; i++) {
       if (random(99U) <= lns) {
         if (!fzs.iv[iv_lns_obj_relax_idx[i]].assigned()){
-          rel(fzs, fzs.iv[iv_lns_obj_relax_idx[i]], IRT_EQ, last.iv[iv_lns_obj_relax_idx[i]].val());
+          fix << fzs.iv[iv_lns_obj_relax_idx[i]]; val << last.iv[iv_lns_obj_relax_idx[i]].val();
         }
         
       }
     }
+    dom(fzs, fix, val);
     return false;
   }
 
@@ -355,11 +362,14 @@ bool LNSstrategies::costImpactGuided(FlatZincSpace& fzs, MetaInfo mi, std::atomi
     }
 
     // Relax the chosen variables.
+    IntVarArgs fix(static_cast<int>(varsToRelax.size()));
+    IntArgs val(static_cast<int>(varsToRelax.size()));
     for (long unsigned int i = 0; i < varsToRelax.size(); ++i){
       unsigned int ivIndex = varsToRelax[i].ivIndex;
-      rel(fzs, fzs.iv[iv_lns_default_idx[ivIndex]], IRT_EQ, last.iv[iv_lns_default_idx[ivIndex]].val());
-      
+      fix[i] = fzs.iv[iv_lns_default_idx[ivIndex]];
+      val[i] = last.iv[iv_lns_default_idx[ivIndex]].val();
     }
+    dom(fzs, fix, val);
     // Only return false if variables were relaxed.
     return !(varsToRelax.size() > 0);
 
@@ -417,8 +427,10 @@ bool LNSstrategies::staticVariableRelation(FlatZincSpace& fzs, MetaInfo mi, std:
     // Select random initial variable to fix given random variables and their relations.
     int var_index = selectRandomBestVar(indices, ((int)ceil(idx_size*0.3)), fzs.variable_relations, idx_size, random);
     unsigned int fixed_vars = 0;
+    IntVarArgs fix; IntArgs val;
     while(fixed_vars < vars_to_fix && indices.size() > 0){
-      rel(fzs, fzs.iv[non_fzn_introduced_vars_idx[indices[var_index]]], IRT_EQ, last.iv[non_fzn_introduced_vars_idx[indices[var_index]]].val());
+      fix << fzs.iv[non_fzn_introduced_vars_idx[indices[var_index]]];
+      val << last.iv[non_fzn_introduced_vars_idx[indices[var_index]]].val();
 
       // Remove frozen variable so it is not picked again.
       std::swap(indices[var_index], indices.back());
@@ -429,6 +441,7 @@ bool LNSstrategies::staticVariableRelation(FlatZincSpace& fzs, MetaInfo mi, std:
 
       fixed_vars++;
     }
+    dom(fzs, fix, val);
     return false;
   }
   return true;
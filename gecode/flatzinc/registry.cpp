@@ -1310,6 +1310,15 @@ namespace Gecode { namespace FlatZinc {
       extensional(s,x,ts,Reify(s.arg2BoolVar(ce[2]),RM_IMP),s.ann2ipl(ann));
     }
 
+    /// Return propagation level for cumulative constraints annotated with \a ann
+    IntPropLevel
+    ann2cumulativeipl(FlatZincSpace& s, AST::Node* ann) {
+      IntPropLevel ipl = s.ann2ipl(ann);
+      if (ann && ann->hasAtom("timetable_edge_finding"))
+        ipl = static_cast<IntPropLevel>(ipl | IPL_BASIC_ADVANCED);
+      return ipl;
+    }
+
     void p_cumulative_opt(FlatZincSpace& s, const ConExpr& ce,
                       AST::Node* ann) {
       IntVarArgs start = s.arg2intvarargs(ce[0]);
@@ -1318,7 +1327,8 @@ namespace Gecode { namespace FlatZinc {
       BoolVarArgs opt = s.arg2boolvarargs(ce[3]);
       int bound = ce[4]->getInt();
       unshare(s,start);
-      cumulative(s,bound,start,duration,height,opt,s.ann2ipl(ann));
+      cumulative(s,bound,start,duration,height,opt,
+                 ann2cumulativeipl(s,ann));
     }
 
     void p_cumulatives(FlatZincSpace& s, const ConExpr& ce,
@@ -1456,12 +1466,14 @@ namespace Gecode { namespace FlatZinc {
           IntArgs durationI(n);
           for (int i=n; i--;)
             durationI[i] = duration[i].val();
-          cumulative(s, bound, start, durationI, heightI);
+          cumulative(s, bound, start, durationI, heightI,
+                     ann2cumulativeipl(s,ann));
         } else {
           IntVarArgs end(n);
           for (int i = n; i--; )
             end[i] = expr(s,start[i]+duration[i]);
-          cumulative(s, bound, start, duration, end, heightI);
+          cumulative(s, bound, start, duration, end, heightI,
+                     ann2cumulativeipl(s,ann));
         }
       } else if (nonzeroDuration && bound.assigned()) {
         IntArgs machine = IntArgs::create(n,0,0);
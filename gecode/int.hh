@@ -50,6 +50,7 @@
 #include <cfloat>
 
 #include <iostream>
+#include <string>
 #include <vector>
 #include <unordered_map>
 #include <functional>
@@ -1055,6 +1056,17 @@ namespace Gecode {
   GECODE_INT_EXPORT void
   dom(Home home, const IntVarArgs& x, int n,
       IntPropLevel ipl=IPL_DEF);
+  /** \brief Propagates \f$ x_i=n_i\f$ for all \f$0\leq i<|x|\f$
+   *
+   * All variables are assigned in a single post operation without
+   * intermediate propagation.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if
+   * \a x and \a n are of different size.
+   */
+  GECODE_INT_EXPORT void
+  dom(Home home, const IntVarArgs& x, const IntArgs& n,
+      IntPropLevel ipl=IPL_DEF);
 
   /// Propagates \f$ l\leq x\leq m\f$
   GECODE_INT_EXPORT void
@@ -2386,8 +2398,18 @@ namespace Gecode {
       ValueData* vd;
       /// Pointer to all ranges
       Range* range;
-      /// Pointer to all support data
+      /// Pointer to all support data (computed on demand)
       BitSetData* support;
+      /// Number of values (summed over all positions)
+      unsigned int n_vals;
+      /// MDD for the tuples (computed on demand)
+      DFA mdd;
+      /// Mutex for computing supports and MDD on demand
+      Gecode::Support::Mutex m;
+      /// File holding tuple and support data (nullptr if none)
+      char* file;
+      /// Size of file
+      std::size_t file_size;
 
       /// Return newly added tuple
       Tuple add(void);
@@ -2406,6 +2428,12 @@ namespace Gecode {
       /// Finalize datastructure (disallows additions of more Tuples)
       GECODE_INT_EXPORT
       void finalize(void);
+      /// Compute support information (if not yet done)
+      GECODE_INT_EXPORT
+      void supports(void);
+      /// Compute MDD (if not yet done)
+      GECODE_INT_EXPORT
+      void compile(void);
       /// Resize tuple data
       GECODE_INT_EXPORT
       void resize(void);
@@ -2448,6 +2476,18 @@ namespace Gecode {
     /// Initialize with DFA \a dfa for arity \a a
     GECODE_INT_EXPORT
     TupleSet(int a, const DFA& dfa);
+    /** \brief Initialize from file \a fn written by TupleSet::write
+     *
+     * The tuple set is finalized. If supported by the platform, the
+     * file is mapped read-only into memory such that processes using
+     * the same file share its memory.
+     *
+     * Throws an exception of type Int::InvalidTupleSetFile, if the
+     * file cannot be read or has not been written by a compatible
+     * platform.
+     */
+    GECODE_INT_EXPORT
+    explicit TupleSet(const std::string& fn);
     /// Test whether tuple set has been initialized
     operator bool(void) const;
     /// Test whether tuple set is equal to \a t
@@ -2484,6 +2524,28 @@ namespace Gecode {
     std::size_t hash(void) const;
     //@}
 
+    /// \name Serialization
+    //@{
+    /** \brief Write finalized tuple set to file \a fn
+     *
+     * Throws the following exceptions:
+     *  - Int::NotYetFinalized, if the tuple set is not finalized.
+     *  - Int::InvalidTupleSetFile, if the file cannot be written.
+     */
+    GECODE_INT_EXPORT
+    void write(const std::string& fn) const;
+    //@}
+
+    /// \name MDD access
+    //@{
+    /** \brief Return reduced MDD for the tuples as a DFA
+     *
+     * The MDD shares common prefixes and suffixes of the tuples and
+     * is computed on first access.
+     */
+    DFA mdd(void) const;
+    //@}
+
     /// \name Range access and iteration
     //@{
     /// Return first range for position \a i
@@ -2566,6 +2628,11 @@ namespace Gecode {
   /** \brief Post propagator for \f$x\in t\f$.
    *
    * \li Supports domain consistency (\a ipl = IPL_DOM, default) only.
+   * \li If \a ipl includes IPL_BASIC, a compact-table propagator is
+   *     used. If \a ipl includes IPL_ADVANCED, a propagator for an MDD
+   *     computed from \a t is used. Otherwise, the MDD is used only if
+   *     it is much smaller than the supports of the compact-table
+   *     propagator.
    * \li Throws an exception of type Int::ArgumentSizeMismatch, if
    *     \a x and \a t are of different size.
    * \li Throws an exception of type Int::NotYetFinalized, if the tuple
@@ -2582,6 +2649,11 @@ namespace Gecode {
    * \li If \a pos is true, it posts a propagator for \f$x\in t\f$
    *     and otherwise for \f$x\not\in t\f$.
    * \li Supports domain consistency (\a ipl = IPL_DOM, default) only.
+   * \li If \a pos is true and \a ipl includes IPL_BASIC, a
+   *     compact-table propagator is used. If \a pos is true and \a ipl
+   *     includes IPL_ADVANCED, a propagator for an MDD computed from
+   *     \a t is used. Otherwise, the MDD is used only if it is much
+   *     smaller than the supports of the compact-table propagator.
    * \li Throws an exception of type Int::ArgumentSizeMismatch, if
    *     \a x and \a t are of different size.
    * \li Throws an exception of type Int::NotYetFinalized, if the tuple
@@ -2627,6 +2699,11 @@ namespace Gecode {
   /** \brief Post propagator for \f$x\in t\f$.
    *
    * \li Supports domain consistency (\a ipl = IPL_DOM, default) only.
+   * \li If \a ipl includes IPL_BASIC, a compact-table propagator is
+   *     used. If \a ipl includes IPL_ADVANCED, a propagator for an MDD
+   *     computed from \a t is used. Otherwise, the MDD is used only if
+   *     it is much smaller than the supports of the compact-table
+   *     propagator.
    * \li Throws an exception of type Int::ArgumentSizeMismatch, if
    *     \a x and \a t are of different size.
    * \li Throws an exception of type Int::NotYetFinalized, if the tuple
@@ -2643,6 +2720,11 @@ namespace Gecode {
    * \li If \a pos is true, it posts a propagator for \f$x\in t\f$
    *     and otherwise for \f$x\not\in t\f$.
    * \li Supports domain consistency (\a ipl = IPL_DOM, default) only.
+   * \li If \a pos is true and \a ipl includes IPL_BASIC, a
+   *     compact-table propagator is used. If \a pos is true and \a ipl
+   *     includes IPL_ADVANCED, a propagator for an MDD computed from
+   *     \a t is used. Otherwise, the MDD is used only if it is much
+   *     smaller than the supports of the compact-table propagator.
    * \li Throws an exception of type Int::ArgumentSizeMismatch, if
    *     \a x and \a t are of different size.
    * \li Throws an exception of type Int::NotYetFinalized, if the tuple
@@ -3647,7 +3729,7 @@ namespace Gecode {
    *  - If \a IPL_ADVANCED is set, the propagator performs overload checking
    *    and edge finding.
    *  - If both flags are combined, all the above listed propagation is
-   *    performed.
+   *    performed, together with timetable-edge-finding.
    *
    * The propagator uses algorithms taken from:
    *
@@ -3751,7 +3833,7 @@ namespace Gecode {
    *  - If \a IPL_ADVANCED is set, the propagator performs overload checking
    *    and edge finding.
    *  - If both flags are combined, all the above listed propagation is
-   *    performed.
+   *    performed, together with timetable-edge-finding.
    *
    * The propagator uses algorithms taken from:
    *
@@ -3843,7 +3925,7 @@ namespace Gecode {
    *  - If \a IPL_ADVANCED is set, the propagator performs overload checking
    *    and edge finding.
    *  - If both flags are combined, all the above listed propagation is
-   *    performed.
+   *    performed, together with timetable-edge-finding.
    *
    * The propagator uses algorithms taken from:
    *
@@ -3940,15 +4022,19 @@ namespace Gecode {
    * Supports domain (\a ipl = IPL_DOM) and value propagation (all
    * other values for \a ipl), where this refers to whether value or
    * domain consistent distinct in enforced on \a x.
+   * Strong connectivity of the graph is only checked on every
+   * \a scc-th execution of the propagator, while cycles that are too
+   * short are always pruned.
    *
    * Throws the following exceptions:
    *  - Int::ArgumentSame, if \a x contains the same unassigned variable
    *    multiply.
    *  - Int::TooFewArguments, if \a x has no elements.
+   *  - Int::OutOfLimits, if \a scc is zero.
    */
   GECODE_INT_EXPORT void
   circuit(Home home, const IntVarArgs& x,
-          IntPropLevel ipl=IPL_DEF);
+          IntPropLevel ipl=IPL_DEF, unsigned int scc=1U);
   /** \brief Post propagator such that \a x forms a circuit
    *
    * \a x forms a circuit if the graph with edges \f$i\to j\f$ where
@@ -3957,16 +4043,19 @@ namespace Gecode {
    * Supports domain (\a ipl = IPL_DOM) and value propagation (all
    * other values for \a ipl), where this refers to whether value or
    * domain consistent distinct in enforced on \a x.
+   * Strong connectivity of the graph is only checked on every
+   * \a scc-th execution of the propagator, while cycles that are too
+   * short are always pruned.
    *
    * Throws the following exceptions:
    *  - Int::ArgumentSame, if \a x contains the same unassigned variable
    *    multiply.
    *  - Int::TooFewArguments, if \a x has no elements.
-   *  - Int::OutOfLimits, if \a offset is negative.
+   *  - Int::OutOfLimits, if \a offset is negative or \a scc is zero.
    */
   GECODE_INT_EXPORT void
   circuit(Home home, int offset, const IntVarArgs& x,
-          IntPropLevel ipl=IPL_DEF);
+          IntPropLevel ipl=IPL_DEF, unsigned int scc=1U);
   /** \brief Post propagator such that \a x forms a circuit with costs \a y and \a z
    *
    * \a x forms a circuit if the graph with edges \f$i\to j\f$ where
@@ -3980,6 +4069,10 @@ namespace Gecode {
    * Supports domain (\a ipl = IPL_DOM) and value propagation (all
    * other values for \a ipl), where this refers to whether value or
    * domain consistent distinct in enforced on \a x for circuit.
+   * Strong connectivity of the graph is only checked on every
+   * \a scc-th execution of the propagator. If \a ipl includes
+   * IPL_ADVANCED, the cost of a minimum cost assignment of successors
+   * is propagated as a lower bound on \a z.
    *
    * Throws the following exceptions:
    *  - Int::ArgumentSame, if \a x contains the same unassigned variable
@@ -3987,12 +4080,13 @@ namespace Gecode {
    *  - Int::TooFewArguments, if \a x has no elements.
    *  - Int::ArgumentSizeMismatch, if \a x and \a y do not have the same
    *    size or if \f$|x|\times|x|\neq|c|\f$.
+   *  - Int::OutOfLimits, if \a scc is zero.
    */
   GECODE_INT_EXPORT void
   circuit(Home home,
           const IntArgs& c,
           const IntVarArgs& x, const IntVarArgs& y, IntVar z,
-          IntPropLevel ipl=IPL_DEF);
+          IntPropLevel ipl=IPL_DEF, unsigned int scc=1U);
   /** \brief Post propagator such that \a x forms a circuit with costs \a y and \a z
    *
    * \a x forms a circuit if the graph with edges \f$i\to j\f$ where
@@ -4006,6 +4100,10 @@ namespace Gecode {
    * Supports domain (\a ipl = IPL_DOM) and value propagation (all
    * other values for \a ipl), where this refers to whether value or
    * domain consistent distinct in enforced on \a x for circuit.
+   * Strong connectivity of the graph is only checked on every
+   * \a scc-th execution of the propagator. If \a ipl includes
+   * IPL_ADVANCED, the cost of a minimum cost assignment of successors
+   * is propagated as a lower bound on \a z.
    *
    * Throws the following exceptions:
    *  - Int::ArgumentSame, if \a x contains the same unassigned variable
@@ -4013,13 +4111,13 @@ namespace Gecode {
    *  - Int::TooFewArguments, if \a x has no elements.
    *  - Int::ArgumentSizeMismatch, if \a x and \a y do not have the same
    *    size or if \f$|x|\times|x|\neq|c|\f$.
-   *  - Int::OutOfLimits, if \a offset is negative.
+   *  - Int::OutOfLimits, if \a offset is negative or \a scc is zero.
    */
   GECODE_INT_EXPORT void
   circuit(Home home,
           const IntArgs& c, int offset,
           const IntVarArgs& x, const IntVarArgs& y, IntVar z,
-          IntPropLevel ipl=IPL_DEF);
+          IntPropLevel ipl=IPL_DEF, unsigned int scc=1U);
   /** \brief Post propagator such that \a x forms a circuit with cost \a z
    *
    * \a x forms a circuit if the graph with edges \f$i\to j\f$ where
@@ -4031,18 +4129,23 @@ namespace Gecode {
    * Supports domain (\a ipl = IPL_DOM) and value propagation (all
    * other values for \a ipl), where this refers to whether value or
    * domain consistent distinct in enforced on \a x for circuit.
+   * Strong connectivity of the graph is only checked on every
+   * \a scc-th execution of the propagator. If \a ipl includes
+   * IPL_ADVANCED, the cost of a minimum cost assignment of successors
+   * is propagated as a lower bound on \a z.
    *
    * Throws the following exceptions:
    *  - Int::ArgumentSame, if \a x contains the same unassigned variable
    *    multiply.
    *  - Int::TooFewArguments, if \a x has no elements.
    *  - Int::ArgumentSizeMismatch, if \f$|x|\times|x|\neq|c|\f$.
+   *  - Int::OutOfLimits, if \a scc is zero.
    */
   GECODE_INT_EXPORT void
   circuit(Home home,
           const IntArgs& c,
           const IntVarArgs& x, IntVar z,
-          IntPropLevel ipl=IPL_DEF);
+          IntPropLevel ipl=IPL_DEF, unsigned int scc=1U);
   /** \brief Post propagator such that \a x forms a circuit with cost \a z
    *
    * \a x forms a circuit if the graph with edges \f$i\to j\f$ where
@@ -4055,19 +4158,23 @@ namespace Gecode {
    * Supports domain (\a ipl = IPL_DOM) and value propagation (all
    * other values for \a ipl), where this refers to whether value or
    * domain consistent distinct in enforced on \a x for circuit.
+   * Strong connectivity of the graph is only checked on every
+   * \a scc-th execution of the propagator. If \a ipl includes
+   * IPL_ADVANCED, the cost of a minimum cost assignment of successors
+   * is propagated as a lower bound on \a z.
    *
    * Throws the following exceptions:
    *  - Int::ArgumentSame, if \a x contains the same unassigned variable
    *    multiply.
    *  - Int::TooFewArguments, if \a x has no elements.
    *  - Int::ArgumentSizeMismatch, if \f$|x|\times|x|\neq|c|\f$.
-   *  - Int::OutOfLimits, if \a offset is negative.
+   *  - Int::OutOfLimits, if \a offset is negative or \a scc is zero.
    */
   GECODE_INT_EXPORT void
   circuit(Home home,
           const IntArgs& c, int offset,
           const IntVarArgs& x, IntVar z,
-          IntPropLevel ipl=IPL_DEF);
+          IntPropLevel ipl=IPL_DEF, unsigned int scc=1U);
   /** \brief Post propagator such that \a x forms a Hamiltonian path
    *
    * \a x forms a Hamiltonian path if the graph with edges \f$i\to j\f$
@@ -38,12 +38,15 @@
 namespace Gecode {
 
   void
-  circuit(Home home, int offset, const IntVarArgs& x, IntPropLevel ipl) {
+  circuit(Home home, int offset, const IntVarArgs& x, IntPropLevel ipl,
+          unsigned int scc) {
     Int::Limits::nonnegative(offset,"Int::circuit");
     if (x.size() == 0)
       throw Int::TooFewArguments("Int::circuit");
     if (same(x))
       throw Int::ArgumentSame("Int::circuit");
+    if (scc == 0U)
+      throw Int::OutOfLimits("Int::circuit");
     GECODE_POST;
     ViewArray<Int::IntView> xv(home,x);
 
@@ -52,32 +55,33 @@ namespace Gecode {
       NOV no;
       if (vbd(ipl) == IPL_DOM) {
         GECODE_ES_FAIL((Int::Circuit::Dom<Int::IntView,NOV>
-                        ::post(home,xv,no)));
+                        ::post(home,xv,no,scc)));
       } else {
         GECODE_ES_FAIL((Int::Circuit::Val<Int::IntView,NOV>
-                        ::post(home,xv,no)));
+                        ::post(home,xv,no,scc)));
       }
     } else {
       typedef Int::Offset OV;
       OV off(-offset);
       if (vbd(ipl) == IPL_DOM) {
         GECODE_ES_FAIL((Int::Circuit::Dom<Int::IntView,OV>
-                        ::post(home,xv,off)));
+                        ::post(home,xv,off,scc)));
       } else {
         GECODE_ES_FAIL((Int::Circuit::Val<Int::IntView,OV>
-                        ::post(home,xv,off)));
+                        ::post(home,xv,off,scc)));
       }
     }
   }
   void
-  circuit(Home home, const IntVarArgs& x, IntPropLevel ipl) {
-    circuit(home,0,x,ipl);
+  circuit(Home home, const IntVarArgs& x, IntPropLevel ipl,
+          unsigned int scc) {
+    circuit(home,0,x,ipl,scc);
   }
 
   void
   circuit(Home home, const IntArgs& c, int offset,
           const IntVarArgs& x, const IntVarArgs& y, IntVar z,
-          IntPropLevel ipl) {
+          IntPropLevel ipl, unsigned int scc) {
     Int::Limits::nonnegative(offset,"Int::circuit");
     int n = x.size();
     if (n == 0)
@@ -86,7 +90,7 @@ namespace Gecode {
       throw Int::ArgumentSame("Int::circuit");
     if ((y.size() != n) || (c.size() != n*n))
       throw Int::ArgumentSizeMismatch("Int::circuit");
-    circuit(home, offset, x, ipl);
+    circuit(home, offset, x, ipl, scc);
     GECODE_POST;
     IntArgs cx(offset+n);
     for (int i=0; i<offset; i++)
@@ -97,27 +101,42 @@ namespace Gecode {
       element(home, cx, x[i], y[i]);
     }
     linear(home, y, IRT_EQ, z);
+    if ((ba(ipl) == IPL_ADVANCED) && (n > 2)) {
+      ViewArray<Int::IntView> xv(home,x);
+      IntSharedArray cs(c);
+      if (offset == 0) {
+        typedef Int::NoOffset<Int::IntView> NOV;
+        NOV no;
+        GECODE_ES_FAIL((Int::Circuit::AssignmentBound<Int::IntView,NOV>
+                        ::post(home,xv,z,cs,no)));
+      } else {
+        typedef Int::Offset OV;
+        OV off(-offset);
+        GECODE_ES_FAIL((Int::Circuit::AssignmentBound<Int::IntView,OV>
+                        ::post(home,xv,z,cs,off)));
+      }
+    }
   }
   void
   circuit(Home home, const IntArgs& c,
           const IntVarArgs& x, const IntVarArgs& y, IntVar z,
-          IntPropLevel ipl) {
-    circuit(home,c,0,x,y,z,ipl);
+          IntPropLevel ipl, unsigned int scc) {
+    circuit(home,c,0,x,y,z,ipl,scc);
   }
   void
   circuit(Home home, const IntArgs& c, int offset,
           const IntVarArgs& x, IntVar z,
-          IntPropLevel ipl) {
+          IntPropLevel ipl, unsigned int scc) {
     Int::Limits::nonnegative(offset,"Int::circuit");
     GECODE_POST;
     IntVarArgs y(home, x.size(), Int::Limits::min, Int::Limits::max);
-    circuit(home, c, offset, x, y, z, ipl);
+    circuit(home, c, offset, x, y, z, ipl, scc);
   }
   void
   circuit(Home home, const IntArgs& c,
           const IntVarArgs& x, IntVar z,
-          IntPropLevel ipl) {
-    circuit(home,c,0,x,z,ipl);
+          IntPropLevel ipl, unsigned int scc) {
+    circuit(home,c,0,x,z,ipl,scc);
   }
 
   void
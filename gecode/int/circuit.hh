@@ -50,6 +50,11 @@ namespace Gecode { namespace Int { namespace Circuit {
    * Provides routines for checking that the induced variable value graph
    * is strongly connected and for pruning short cycles.
    *
+   * Short cycles are pruned incrementally: the propagator maintains the
+   * chains of nodes with assigned successors by their first and last
+   * nodes, such that an assignment only joins two chains. The check for
+   * strong connectivity only runs on every \a scc-th execution.
+   *
    */
   template<class View, class Offset>
   class Base : public NaryPropagator<View,Int::PC_INT_DOM> {
@@ -61,12 +66,28 @@ namespace Gecode { namespace Int { namespace Circuit {
     ViewArray<View> y;
     /// Offset transformation
     Offset o;
+    /// Number of executions between checks for strong connectivity
+    unsigned int scc;
+    /// Number of executions until the next check for strong connectivity
+    unsigned int n_scc;
+    /// Nodes with unassigned successor at the last execution
+    int* u;
+    /// Number of nodes in \a u
+    int n_u;
+    /// First node of chain ending at a node (valid for last nodes only)
+    int* fst;
+    /// Last node of chain starting at a node (valid for first nodes only)
+    int* lst;
+    /// Length of chain starting at a node (valid for first nodes only)
+    int* len;
     /// Constructor for cloning \a p
     Base(Space& home, Base& p);
     /// Constructor for posting
-    Base(Home home, ViewArray<View>& x, Offset& o);
+    Base(Home home, ViewArray<View>& x, Offset& o, unsigned int scc);
     /// Check whether the view value graph is strongly connected
     ExecStatus connected(Space& home);
+    /// Test whether strong connectivity is to be checked now
+    bool check(void);
     /// Ensure path property: prune edges that could give too small cycles
     ExecStatus path(Space& home);
   public:
@@ -92,10 +113,12 @@ namespace Gecode { namespace Int { namespace Circuit {
     using Base<View,Offset>::connected;
     using Base<View,Offset>::path;
     using Base<View,Offset>::o;
+    using Base<View,Offset>::check;
+    using Base<View,Offset>::n_u;
     /// Constructor for cloning \a p
     Val(Space& home, Val& p);
     /// Constructor for posting
-    Val(Home home, ViewArray<View>& x, Offset& o);
+    Val(Home home, ViewArray<View>& x, Offset& o, unsigned int scc);
   public:
     /// Copy propagator during cloning
     virtual Actor* copy(Space& home);
@@ -103,8 +126,9 @@ namespace Gecode { namespace Int { namespace Circuit {
     virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
-    /// Post propagator for circuit on \a x
-    static  ExecStatus post(Home home, ViewArray<View>& x, Offset& o);
+    /// Post propagator for circuit on \a x checking connectivity every \a scc executions
+    static  ExecStatus post(Home home, ViewArray<View>& x, Offset& o,
+                            unsigned int scc=1U);
   };
 
   /**
@@ -125,12 +149,14 @@ namespace Gecode { namespace Int { namespace Circuit {
     using Base<View,Offset>::connected;
     using Base<View,Offset>::path;
     using Base<View,Offset>::o;
+    using Base<View,Offset>::check;
+    using Base<View,Offset>::n_u;
     /// Propagation controller for propagating distinct
     Int::Distinct::DomCtrl<View> dc;
     /// Constructor for cloning \a p
     Dom(Space& home, Dom& p);
     /// Constructor for posting
-    Dom(Home home, ViewArray<View>& x, Offset& o);
+    Dom(Home home, ViewArray<View>& x, Offset& o, unsigned int scc);
   public:
     /// Copy propagator during cloning
     virtual Actor* copy(Space& home);
@@ -145,8 +171,63 @@ namespace Gecode { namespace Int { namespace Circuit {
     virtual void reschedule(Space& home);
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
-    /// Post propagator for circuit on \a x
-    static  ExecStatus post(Home home, ViewArray<View>& x, Offset& o);
+    /// Post propagator for circuit on \a x checking connectivity every \a scc executions
+    static  ExecStatus post(Home home, ViewArray<View>& x, Offset& o,
+                            unsigned int scc=1U);
+  };
+
+  /**
+   * \brief Propagator for a lower bound on the cost of a circuit
+   *
+   * The cost of a minimum cost assignment of successors to nodes is a
+   * lower bound on the cost of the circuit. The propagator maintains
+   * such an assignment together with dual values between executions
+   * and only repairs the assignment by augmenting paths for nodes
+   * whose assigned successor has been pruned. The reduced costs with
+   * respect to the dual values prune edges that would exceed the upper
+   * bound on the cost.
+   *
+   * Requires \code #include <gecode/int/circuit.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class View, class Offset>
+  class AssignmentBound : public Propagator {
+  protected:
+    /// Successor views
+    ViewArray<View> x;
+    /// Cost view
+    Int::IntView z;
+    /// Edge costs
+    IntSharedArray c;
+    /// Offset transformation
+    Offset o;
+    /// Dual values for nodes (indices from 1)
+    long long int* u;
+    /// Dual values for successors (indices from 1)
+    long long int* v;
+    /// Node assigned to successor (indices from 1, 0 if none)
+    int* p;
+    /// Constructor for cloning \a p
+    AssignmentBound(Space& home, AssignmentBound& p);
+    /// Constructor for posting
+    AssignmentBound(Home home, ViewArray<View>& x, Int::IntView z,
+                    IntSharedArray& c, Offset& o);
+    /// Assign a successor to node \a i by an augmenting path
+    bool augment(int i);
+  public:
+    /// Copy propagator during cloning
+    virtual Actor* copy(Space& home);
+    /// Cost function (returns high quadratic)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+    /// Post propagator for cost \a z of circuit \a x with edge costs \a c
+    static  ExecStatus post(Home home, ViewArray<View>& x, Int::IntView z,
+                            IntSharedArray& c, Offset& o);
   };
 
 }}}
@@ -154,6 +235,7 @@ namespace Gecode { namespace Int { namespace Circuit {
 #include <gecode/int/circuit/base.hpp>
 #include <gecode/int/circuit/val.hpp>
 #include <gecode/int/circuit/dom.hpp>
+#include <gecode/int/circuit/bound.hpp>
 
 #endif
 
@@ -35,18 +35,48 @@ namespace Gecode { namespace Int { namespace Circuit {
 
   template<class View, class Offset>
   forceinline
-  Base<View,Offset>::Base(Home home, ViewArray<View>& x, Offset& o0)
+  Base<View,Offset>::Base(Home home, ViewArray<View>& x, Offset& o0,
+                          unsigned int scc0)
     : NaryPropagator<View,Int::PC_INT_DOM>(home,x),
-      start(0), y(home,x), o(o0) {
+      start(0), y(home,x), o(o0), scc(scc0), n_scc(scc0) {
+    int n = x.size();
+    Space& s = home;
+    u = s.alloc<int>(n); n_u = n;
+    fst = s.alloc<int>(n);
+    lst = s.alloc<int>(n);
+    len = s.alloc<int>(n);
+    for (int i=0; i<n; i++) {
+      u[i] = fst[i] = lst[i] = i; len[i] = 1;
+    }
     home.notice(*this,AP_WEAKLY);
   }
 
   template<class View, class Offset>
   forceinline
   Base<View,Offset>::Base(Space& home, Base<View,Offset>& p)
-    : NaryPropagator<View,Int::PC_INT_DOM>(home,p), start(p.start) {
+    : NaryPropagator<View,Int::PC_INT_DOM>(home,p), start(p.start),
+      scc(p.scc), n_scc(p.n_scc), n_u(p.n_u) {
     o.update(p.o);
     y.update(home,p.y);
+    int n = x.size();
+    u = home.alloc<int>(n_u);
+    fst = home.alloc<int>(n);
+    lst = home.alloc<int>(n);
+    len = home.alloc<int>(n);
+    for (int i=0; i<n_u; i++)
+      u[i] = p.u[i];
+    for (int i=0; i<n; i++) {
+      fst[i] = p.fst[i]; lst[i] = p.lst[i]; len[i] = p.len[i];
+    }
+  }
+
+  template<class View, class Offset>
+  forceinline bool
+  Base<View,Offset>::check(void) {
+    if (--n_scc > 0U)
+      return false;
+    n_scc = scc;
+    return true;
   }
 
   /// Information required for non-recursive checking for a single scc
@@ -240,49 +270,43 @@ namespace Gecode { namespace Int { namespace Circuit {
 
     Region r;
 
-    // The path starting at assigned x[i] ends at x[end[j]] which is
-    // not assigned.
-    int* end = r.alloc<int>(n);
-    for (int i=0; i<n; i++)
-      end[i]=-1;
-
-    // A stack that records all indices i such that end[i] != -1
-    Support::StaticStack<int,Region> tell(r,n);
-
-    typedef typename Offset::ViewType OView;
-    for (int i=0; i<y.size(); i++) {
-      assert(!y[i].assigned());
-      // Non-assigned views serve as starting points for assigned paths
-      Int::ViewValues<OView> v(o(y[i]));
-      // Try all connected values
-      do {
-        int j0=v.val();
-        // Starting point for not yet followed assigned path found
-        if (x[j0].assigned() && (end[j0] < 0)) {
-          // Follow assigned path until non-assigned view:
-          // all assigned view on the paths can be skipped, as
-          // if x[i] is assigned to j, then x[j] will only have
-          // x[i] as predecessor due to propagating distinct.
-          int j = j0;
-          do {
-            j=o(x[j]).val();
-          } while (x[j].assigned());
-          // Now there cannot be a cycle from x[j] to x[v.val()]!
-          // However, the tell cannot be done here as j might be
-          // equal to i and might hence kill the iterator v!
-          end[j0]=j; tell.push(j0);
-        }
-        ++v;
-      } while (v());
-    }
+    /*
+     * Find the nodes whose successors have been assigned since the
+     * last execution. They are collected first, as the pruning below
+     * might assign further successors: these are only processed after
+     * distinct has been propagated for them.
+     */
+    int* a = r.alloc<int>(n_u);
+    int n_a = 0;
+    for (int k=n_u; k--; )
+      if (x[u[k]].assigned()) {
+        a[n_a++] = u[k]; u[k] = u[--n_u];
+      }
 
-    // Now do the tells based on the end information
-    while (!tell.empty()) {
-      int i = tell.pop();
-      assert(end[i] >= 0);
-      GECODE_ME_CHECK(o(x[end[i]]).nq(home,i));
+    ExecStatus es = ES_FIX;
+    for (int k=0; k<n_a; k++) {
+      // Join the chain ending at i with the chain starting at j
+      int i = a[k];
+      int j = o(x[i]).val();
+      int f = fst[i];
+      if (f == j) {
+        // The chain is closed to a cycle, which must cover all nodes
+        if (len[f] < n)
+          return ES_FAILED;
+        continue;
+      }
+      int l = lst[j];
+      lst[f] = l; fst[l] = f; len[f] += len[j];
+      // Closing the chain must not create a cycle that is too short
+      if (len[f] < n) {
+        ModEvent me = o(x[l]).nq(home,f);
+        if (me_failed(me))
+          return ES_FAILED;
+        if (me_modified(me))
+          es = ES_NOFIX;
+      }
     }
-    return ES_NOFIX;
+    return es;
   }
 
   template<class View, class Offset>
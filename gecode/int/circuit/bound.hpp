@@ -0,0 +1,232 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Circuit {
+
+  template<class View, class Offset>
+  forceinline
+  AssignmentBound<View,Offset>::AssignmentBound(Home home,
+                                                ViewArray<View>& x0,
+                                                Int::IntView z0,
+                                                IntSharedArray& c0,
+                                                Offset& o0)
+    : Propagator(home), x(x0), z(z0), c(c0), o(o0) {
+    int n = x.size();
+    Space& s = home;
+    u = s.alloc<long long int>(n+1);
+    v = s.alloc<long long int>(n+1);
+    p = s.alloc<int>(n+1);
+    for (int j=0; j<=n; j++) {
+      v[j] = 0; p[j] = 0;
+    }
+    // Dual values for nodes such that no reduced cost is negative
+    typedef typename Offset::ViewType OView;
+    u[0] = 0;
+    for (int i=0; i<n; i++) {
+      long long int m = Int::Limits::llmax;
+      for (Int::ViewValues<OView> j(o(x[i])); j(); ++j)
+        m = std::min(m, static_cast<long long int>(c[i*n+j.val()]));
+      u[i+1] = m;
+    }
+    home.notice(*this,AP_DISPOSE);
+    x.subscribe(home,*this,PC_INT_DOM);
+    z.subscribe(home,*this,PC_INT_BND);
+  }
+
+  template<class View, class Offset>
+  forceinline
+  AssignmentBound<View,Offset>::AssignmentBound(Space& home,
+                                                AssignmentBound& q)
+    : Propagator(home,q), c(q.c) {
+    x.update(home,q.x);
+    z.update(home,q.z);
+    o.update(q.o);
+    int n = x.size();
+    u = home.alloc<long long int>(n+1);
+    v = home.alloc<long long int>(n+1);
+    p = home.alloc<int>(n+1);
+    for (int j=0; j<=n; j++) {
+      u[j] = q.u[j]; v[j] = q.v[j]; p[j] = q.p[j];
+    }
+  }
+
+  template<class View, class Offset>
+  Actor*
+  AssignmentBound<View,Offset>::copy(Space& home) {
+    return new (home) AssignmentBound<View,Offset>(home,*this);
+  }
+
+  template<class View, class Offset>
+  PropCost
+  AssignmentBound<View,Offset>::cost(const Space&,
+                                     const ModEventDelta&) const {
+    return PropCost::quadratic(PropCost::HI, x.size());
+  }
+
+  template<class View, class Offset>
+  void
+  AssignmentBound<View,Offset>::reschedule(Space& home) {
+    x.reschedule(home,*this,PC_INT_DOM);
+    z.reschedule(home,*this,PC_INT_BND);
+  }
+
+  template<class View, class Offset>
+  forceinline size_t
+  AssignmentBound<View,Offset>::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    x.cancel(home,*this,PC_INT_DOM);
+    z.cancel(home,*this,PC_INT_BND);
+    c.~IntSharedArray();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class View, class Offset>
+  bool
+  AssignmentBound<View,Offset>::augment(int i) {
+    /*
+     * Shortest augmenting path from node i with respect to reduced
+     * costs (Hungarian method). Index 0 serves as an artificial
+     * successor that is assigned to node i during the search.
+     */
+    typedef typename Offset::ViewType OView;
+    const long long int inf = Int::Limits::llinfinity;
+    int n = x.size();
+    Region r;
+    // Shortest distance to successor
+    long long int* d = r.alloc<long long int>(n+1);
+    // Predecessor of successor on shortest path
+    int* w = r.alloc<int>(n+1);
+    // Whether successor has been reached
+    bool* s = r.alloc<bool>(n+1);
+    for (int j=0; j<=n; j++) {
+      d[j] = inf; s[j] = false;
+    }
+    p[0] = i;
+    int j0 = 0;
+    do {
+      s[j0] = true;
+      int i0 = p[j0];
+      for (Int::ViewValues<OView> j(o(x[i0-1])); j(); ++j) {
+        int j1 = j.val()+1;
+        if (!s[j1]) {
+          long long int rc = c[(i0-1)*n+j.val()] - u[i0] - v[j1];
+          if (rc < d[j1]) {
+            d[j1] = rc; w[j1] = j0;
+          }
+        }
+      }
+      long long int delta = inf;
+      int j1 = 0;
+      for (int j=1; j<=n; j++)
+        if (!s[j] && (d[j] < delta)) {
+          delta = d[j]; j1 = j;
+        }
+      // No successor is left for node i
+      if (delta == inf)
+        return false;
+      for (int j=0; j<=n; j++)
+        if (s[j]) {
+          u[p[j]] += delta; v[j] -= delta;
+        } else if (d[j] != inf) {
+          d[j] -= delta;
+        }
+      j0 = j1;
+    } while (p[j0] != 0);
+    // Flip the assignment along the augmenting path
+    do {
+      int j1 = w[j0]; p[j0] = p[j1]; j0 = j1;
+    } while (j0 != 0);
+    return true;
+  }
+
+  template<class View, class Offset>
+  ExecStatus
+  AssignmentBound<View,Offset>::propagate(Space& home, const ModEventDelta&) {
+    typedef typename Offset::ViewType OView;
+    int n = x.size();
+    Region r;
+
+    // Drop assignments to successors that have been pruned
+    bool* a = r.alloc<bool>(n+1);
+    for (int i=0; i<=n; i++)
+      a[i] = false;
+    for (int j=1; j<=n; j++)
+      if (p[j] != 0) {
+        if (o(x[p[j]-1]).in(j-1))
+          a[p[j]] = true;
+        else
+          p[j] = 0;
+      }
+    // Repair the assignment: as domains only shrink the dual values
+    // remain feasible and the assignment remains of minimum cost
+    for (int i=1; i<=n; i++)
+      if (!a[i] && !augment(i))
+        return ES_FAILED;
+
+    long long int lb = 0;
+    for (int j=1; j<=n; j++)
+      lb += c[(p[j]-1)*n+j-1];
+    if (lb > z.max())
+      return ES_FAILED;
+    if (lb > z.min())
+      GECODE_ME_CHECK(z.gq(home,static_cast<int>(lb)));
+
+    // Prune edges whose reduced cost exceeds the slack of the cost
+    long long int slack = z.max() - lb;
+    int* nq = r.alloc<int>(n);
+    bool assigned = true;
+    for (int i=0; i<n; i++) {
+      int k = 0;
+      for (Int::ViewValues<OView> j(o(x[i])); j(); ++j)
+        if (c[i*n+j.val()] - u[i+1] - v[j.val()+1] > slack)
+          nq[k++] = j.val();
+      if (k > 0) {
+        Iter::Values::Array iv(nq,k);
+        GECODE_ME_CHECK(o(x[i]).minus_v(home,iv,false));
+      }
+      if (!x[i].assigned())
+        assigned = false;
+    }
+    // The edges in the assignment have no reduced cost and are kept
+    return assigned ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+  template<class View, class Offset>
+  ExecStatus
+  AssignmentBound<View,Offset>::post(Home home, ViewArray<View>& x,
+                                     Int::IntView z, IntSharedArray& c,
+                                     Offset& o) {
+    (void) new (home) AssignmentBound<View,Offset>(home,x,z,c,o);
+    return ES_OK;
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -39,8 +39,9 @@ namespace Gecode { namespace Int { namespace Circuit {
    */
   template<class View, class Offset>
   forceinline
-  Dom<View,Offset>::Dom(Home home, ViewArray<View>& x, Offset& o)
-    : Base<View,Offset>(home,x,o) {}
+  Dom<View,Offset>::Dom(Home home, ViewArray<View>& x, Offset& o,
+                          unsigned int scc)
+    : Base<View,Offset>(home,x,o,scc) {}
 
   template<class View, class Offset>
   forceinline
@@ -78,11 +79,20 @@ namespace Gecode { namespace Int { namespace Circuit {
   Dom<View,Offset>::propagate(Space& home, const ModEventDelta& med) {
     if (View::me(med) == Int::ME_INT_VAL) {
       GECODE_ES_CHECK((Int::Distinct::prop_val<View,true>(home,y)));
-      ExecStatus escv = connected(home);
-      if (escv != ES_FIX)
-        return escv;
+      ExecStatus esp = path(home);
+      if (esp == ES_FAILED)
+        return ES_FAILED;
+      if (n_u == 0)
+        return home.ES_SUBSUMED(*this);
+      if (check()) {
+        ExecStatus escv = connected(home);
+        if (escv != ES_FIX)
+          return escv;
+      }
       if (y.size() < 2)
         return home.ES_SUBSUMED(*this);
+      if (esp == ES_NOFIX)
+        return home.ES_NOFIX_PARTIAL(*this,View::med(Int::ME_INT_DOM));
       return home.ES_FIX_PARTIAL(*this,View::med(Int::ME_INT_DOM));
     }
 
@@ -94,9 +104,19 @@ namespace Gecode { namespace Int { namespace Circuit {
     bool assigned;
     GECODE_ES_CHECK(dc.propagate(home,assigned));
 
-    ExecStatus esc = connected(home);
-    if (esc != ES_FIX)
-      return esc;
+    ExecStatus es = path(home);
+    if (es == ES_FAILED)
+      return ES_FAILED;
+    if (n_u == 0)
+      return home.ES_SUBSUMED(*this);
+
+    if (check()) {
+      ExecStatus esc = connected(home);
+      if (esc == ES_NOFIX)
+        es = ES_NOFIX;
+      else if (esc != ES_FIX)
+        return esc;
+    }
 
     // Eliminate assigned views from y, as they have been assigned
     // and propagated by domain consistent propagation. This is required
@@ -106,12 +126,13 @@ namespace Gecode { namespace Int { namespace Circuit {
         if (y[i].assigned())
           y.move_lst(i);
 
-    return path(home);
+    return es;
   }
 
   template<class View, class Offset>
   ExecStatus
-  Dom<View,Offset>::post(Home home, ViewArray<View>& x, Offset& o) {
+  Dom<View,Offset>::post(Home home, ViewArray<View>& x, Offset& o,
+                            unsigned int scc) {
     int n = x.size();
     if (n == 1) {
       GECODE_ME_CHECK(o(x[0]).eq(home,0));
@@ -124,7 +145,7 @@ namespace Gecode { namespace Int { namespace Circuit {
         GECODE_ME_CHECK(o(x[i]).le(home,n));
         GECODE_ME_CHECK(o(x[i]).nq(home,i));
       }
-      (void) new (home) Dom<View,Offset>(home,x,o);
+      (void) new (home) Dom<View,Offset>(home,x,o,scc);
     }
     return ES_OK;
   }
@@ -39,8 +39,9 @@ namespace Gecode { namespace Int { namespace Circuit {
    */
   template<class View, class Offset>
   forceinline
-  Val<View,Offset>::Val(Home home, ViewArray<View>& x, Offset& o)
-    : Base<View,Offset>(home,x,o) {}
+  Val<View,Offset>::Val(Home home, ViewArray<View>& x, Offset& o,
+                          unsigned int scc)
+    : Base<View,Offset>(home,x,o,scc) {}
 
   template<class View, class Offset>
   forceinline
@@ -63,21 +64,32 @@ namespace Gecode { namespace Int { namespace Circuit {
   ExecStatus
   Val<View,Offset>::propagate(Space& home, const ModEventDelta&) {
     GECODE_ES_CHECK((Int::Distinct::prop_val<View,true>(home,y)));
-    ExecStatus esc = connected(home);
-    if (esc != ES_FIX)
-      return esc;
+    ExecStatus es = path(home);
+    if (es == ES_FAILED)
+      return ES_FAILED;
+    // All successors are assigned and form a single cycle
+    if (n_u == 0)
+      return home.ES_SUBSUMED(*this);
+    if (check()) {
+      ExecStatus esc = connected(home);
+      if (esc == ES_NOFIX)
+        es = ES_NOFIX;
+      else if (esc != ES_FIX)
+        return esc;
+    }
     /*
      * One cannot have a single unassigned view as the views constitute
      * a permutation.
      */
     if (y.size() < 2)
       return home.ES_SUBSUMED(*this);
-    return path(home);
+    return es;
   }
 
   template<class View, class Offset>
   ExecStatus
-  Val<View,Offset>::post(Home home, ViewArray<View>& x, Offset& o) {
+  Val<View,Offset>::post(Home home, ViewArray<View>& x, Offset& o,
+                            unsigned int scc) {
     int n = x.size();
     if (n == 1) {
       GECODE_ME_CHECK(o(x[0]).eq(home,0));
@@ -90,7 +102,7 @@ namespace Gecode { namespace Int { namespace Circuit {
         GECODE_ME_CHECK(o(x[i]).le(home,n));
         GECODE_ME_CHECK(o(x[i]).nq(home,i));
       }
-      (void) new (home) Val<View,Offset>(home,x,o);
+      (void) new (home) Val<View,Offset>(home,x,o,scc);
     }
     return ES_OK;
   }
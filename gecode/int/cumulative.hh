@@ -746,6 +746,90 @@ namespace Gecode { namespace Int { namespace Cumulative {
     virtual size_t dispose(Space& home);
   };
 
+  /// Step of a resource profile
+  class ProfileStep {
+  public:
+    /// Time of the step
+    int t;
+    /// Change of the height at the step
+    long long int d;
+    /// Height of the profile from the step on
+    long long int h;
+    /// Energy of the profile before the step
+    long long int e;
+    /// Order by time
+    bool operator <(const ProfileStep& s) const;
+  };
+
+  /// Snapshot of a task for timetable-edge-finding
+  class TTEFTask {
+  public:
+    /// Earliest start time
+    int est;
+    /// Latest completion time
+    int lct;
+    /// Start of compulsory part
+    int lst;
+    /// End of compulsory part
+    int ect;
+    /// Minimal processing time
+    int p;
+    /// Required capacity
+    int c;
+    /// Energy of the part not covered by the compulsory part
+    long long int e;
+  };
+
+  /**
+   * \brief Timetable-edge-finding propagator for cumulative resource with mandatory tasks
+   *
+   * The propagator keeps the profile of compulsory parts between
+   * executions and only updates it for tasks whose compulsory part
+   * has changed. The profile is used for time-tabling consistency
+   * and for timetable-edge-finding on both earliest start and latest
+   * completion times.
+   *
+   * Requires \code #include <gecode/int/cumulative.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class ManTask, class Cap>
+  class TTEF : public TaskProp<ManTask,PLA> {
+  protected:
+    using TaskProp<ManTask,PLA>::t;
+    /// Resource capacity
+    Cap c;
+    /// Start of compulsory part of each task in profile
+    int* cl;
+    /// End of compulsory part of each task in profile
+    int* cu;
+    /// Steps of the profile
+    ProfileStep* ps;
+    /// Number of steps of the profile
+    int np;
+    /// Constructor for creation
+    TTEF(Home home, Cap c, TaskArray<ManTask>& t);
+    /// Constructor for cloning \a p
+    TTEF(Space& home, TTEF& p);
+    /// Update profile for tasks with changed compulsory parts
+    void profile(Region& r);
+    /// Return energy of the profile before time \a x
+    long long int energy(int x) const;
+    /// Perform timetable-edge-finding for snapshots \a s in direction \a fwd
+    ExecStatus ttef(Space& home, Region& r, const TTEFTask* s,
+                    bool fwd, bool& mod);
+  public:
+    /// Perform copying during cloning
+    virtual Actor* copy(Space& home);
+    /// Cost function (defined as high quadratic)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for tasks \a t on cumulative resource
+    static ExecStatus post(Home home, Cap c, TaskArray<ManTask>& t);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
   /// Post mandatory task propagator according to propagation level
   template<class ManTask, class Cap>
   ExecStatus
@@ -764,6 +848,7 @@ namespace Gecode { namespace Int { namespace Cumulative {
 #include <gecode/int/cumulative/edge-finding.hpp>
 #include <gecode/int/cumulative/man-prop.hpp>
 #include <gecode/int/cumulative/opt-prop.hpp>
+#include <gecode/int/cumulative/ttef.hpp>
 #include <gecode/int/cumulative/post.hpp>
 
 #endif
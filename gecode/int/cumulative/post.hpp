@@ -42,7 +42,8 @@ namespace Gecode { namespace Int { namespace Cumulative {
     case IPL_ADVANCED:
       return ManProp<ManTask,Cap,PLA>::post(home,c,t);
     case IPL_BASIC_ADVANCED:
-      return ManProp<ManTask,Cap,PLBA>::post(home,c,t);
+      GECODE_ES_CHECK((ManProp<ManTask,Cap,PLBA>::post(home,c,t)));
+      return TTEF<ManTask,Cap>::post(home,c,t);
     }
     GECODE_NEVER;
     return ES_OK;
@@ -0,0 +1,326 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <algorithm>
+#include <climits>
+
+namespace Gecode { namespace Int { namespace Cumulative {
+
+  forceinline bool
+  ProfileStep::operator <(const ProfileStep& s) const {
+    return t < s.t;
+  }
+
+  /// Sort order for task snapshots by increasing earliest start time
+  class TTEFByEst {
+  public:
+    /// The task snapshots
+    const TTEFTask* s;
+    /// Sort order
+    bool operator ()(int i, int j) const {
+      return s[i].est < s[j].est;
+    }
+  };
+
+  /// Sort order for task snapshots by increasing latest completion time
+  class TTEFByLct {
+  public:
+    /// The task snapshots
+    const TTEFTask* s;
+    /// Sort order
+    bool operator ()(int i, int j) const {
+      return s[i].lct < s[j].lct;
+    }
+  };
+
+
+  template<class ManTask, class Cap>
+  forceinline
+  TTEF<ManTask,Cap>::TTEF(Home home, Cap c0, TaskArray<ManTask>& t)
+    : TaskProp<ManTask,PLA>(home,t), c(c0),
+      cl(static_cast<Space&>(home).alloc<int>(t.size())),
+      cu(static_cast<Space&>(home).alloc<int>(t.size())),
+      ps(static_cast<Space&>(home).alloc<ProfileStep>(2*t.size())), np(0) {
+    for (int i=0; i<t.size(); i++)
+      cl[i] = cu[i] = 0;
+    c.subscribe(home,*this,PC_INT_BND);
+  }
+
+  template<class ManTask, class Cap>
+  forceinline
+  TTEF<ManTask,Cap>::TTEF(Space& home, TTEF<ManTask,Cap>& p)
+    : TaskProp<ManTask,PLA>(home,p),
+      cl(home.alloc<int>(p.t.size())), cu(home.alloc<int>(p.t.size())),
+      ps(home.alloc<ProfileStep>(2*p.t.size())), np(p.np) {
+    c.update(home,p.c);
+    for (int i=0; i<t.size(); i++) {
+      cl[i] = p.cl[i]; cu[i] = p.cu[i];
+    }
+    for (int i=0; i<np; i++)
+      ps[i] = p.ps[i];
+  }
+
+  template<class ManTask, class Cap>
+  ExecStatus
+  TTEF<ManTask,Cap>::post(Home home, Cap c, TaskArray<ManTask>& t) {
+    if (t.size() > 1) {
+      // Other propagators reorder their tasks, so use a private copy
+      TaskArray<ManTask> tt(home,t.size());
+      for (int i=0; i<t.size(); i++)
+        tt[i]=t[i];
+      (void) new (home) TTEF<ManTask,Cap>(home,c,tt);
+    }
+    return ES_OK;
+  }
+
+  template<class ManTask, class Cap>
+  Actor*
+  TTEF<ManTask,Cap>::copy(Space& home) {
+    return new (home) TTEF<ManTask,Cap>(home,*this);
+  }
+
+  template<class ManTask, class Cap>
+  PropCost
+  TTEF<ManTask,Cap>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::quadratic(PropCost::HI,t.size());
+  }
+
+  template<class ManTask, class Cap>
+  forceinline size_t
+  TTEF<ManTask,Cap>::dispose(Space& home) {
+    (void) TaskProp<ManTask,PLA>::dispose(home);
+    c.cancel(home,*this,PC_INT_BND);
+    return sizeof(*this);
+  }
+
+  template<class ManTask, class Cap>
+  void
+  TTEF<ManTask,Cap>::profile(Region& r) {
+    // Collect the changes for tasks whose compulsory part has changed
+    ProfileStep* d = r.alloc<ProfileStep>(4*t.size());
+    int m = 0;
+    for (int i=0; i<t.size(); i++) {
+      int l = t[i].lst(), u = t[i].ect();
+      if ((l >= u) || (t[i].c() == 0))
+        l = u = 0;
+      if ((l != cl[i]) || (u != cu[i])) {
+        if (cl[i] < cu[i]) {
+          d[m].t = cl[i]; d[m].d = -t[i].c(); m++;
+          d[m].t = cu[i]; d[m].d = t[i].c(); m++;
+        }
+        if (l < u) {
+          d[m].t = l; d[m].d = t[i].c(); m++;
+          d[m].t = u; d[m].d = -t[i].c(); m++;
+        }
+        cl[i] = l; cu[i] = u;
+      }
+    }
+    if (m == 0)
+      return;
+    Support::quicksort(d, m);
+    // Merge changes into profile, dropping steps without change
+    ProfileStep* q = r.alloc<ProfileStep>(np+m);
+    int k = 0;
+    {
+      int i = 0, j = 0;
+      while ((i < np) || (j < m)) {
+        int x;
+        if (j == m)
+          x = ps[i].t;
+        else if (i == np)
+          x = d[j].t;
+        else
+          x = std::min(ps[i].t,d[j].t);
+        long long int s = 0;
+        for ( ; (i < np) && (ps[i].t == x); i++)
+          s += ps[i].d;
+        for ( ; (j < m) && (d[j].t == x); j++)
+          s += d[j].d;
+        if (s != 0) {
+          q[k].t = x; q[k].d = s; k++;
+        }
+      }
+    }
+    // Recompute heights and energies
+    long long int h = 0, e = 0;
+    for (int i=0; i<k; i++) {
+      if (i > 0)
+        e += h * (static_cast<long long int>(q[i].t) - q[i-1].t);
+      h += q[i].d;
+      ps[i].t = q[i].t; ps[i].d = q[i].d; ps[i].h = h; ps[i].e = e;
+    }
+    np = k;
+  }
+
+  template<class ManTask, class Cap>
+  forceinline long long int
+  TTEF<ManTask,Cap>::energy(int x) const {
+    // Find last step not after x
+    int l = 0, u = np;
+    while (l < u) {
+      int m = l + (u - l) / 2;
+      if (ps[m].t <= x)
+        l = m + 1;
+      else
+        u = m;
+    }
+    if (l == 0)
+      return 0;
+    const ProfileStep& s = ps[l-1];
+    return s.e + s.h * (static_cast<long long int>(x) - s.t);
+  }
+
+  template<class ManTask, class Cap>
+  ExecStatus
+  TTEF<ManTask,Cap>::ttef(Space& home, Region& r, const TTEFTask* s,
+                          bool fwd, bool& mod) {
+    int n = t.size();
+    long long int cap = c.max();
+
+    int* e = r.alloc<int>(n);
+    int* l = r.alloc<int>(n);
+    for (int i=0; i<n; i++)
+      e[i] = l[i] = i;
+    TTEFByEst be; be.s = s;
+    Support::quicksort(e, n, be);
+    TTEFByLct bl; bl.s = s;
+    Support::quicksort(l, n, bl);
+
+    // Energy of the profile before earliest start and latest completion
+    long long int* ie = r.alloc<long long int>(n);
+    long long int* il = r.alloc<long long int>(n);
+    for (int i=0; i<n; i++)
+      if (fwd) {
+        ie[i] = energy(s[e[i]].est);
+        il[i] = energy(s[l[i]].lct);
+      } else {
+        ie[i] = -energy(-s[e[i]].est);
+        il[i] = -energy(-s[l[i]].lct);
+      }
+
+    // Minimal available energy for windows starting at or before est
+    long long int* av = r.alloc<long long int>(n);
+    // New earliest start times
+    int* ns = r.alloc<int>(n);
+    for (int i=0; i<n; i++)
+      ns[i] = s[i].est;
+
+    for (int q=0; q<n; q++) {
+      int b = s[l[q]].lct;
+      if ((q+1 < n) && (s[l[q+1]].lct == b))
+        continue;
+      // Free energy of tasks within the window [a,b)
+      long long int f = 0;
+      for (int j=n; j--; ) {
+        const TTEFTask& k = s[e[j]];
+        if (k.lct <= b)
+          f += k.e;
+        if (k.est >= b) {
+          av[j] = LLONG_MAX;
+        } else {
+          av[j] = cap * (static_cast<long long int>(b) - k.est)
+            - (il[q] - ie[j]) - f;
+          if (av[j] < 0)
+            return ES_FAILED;
+        }
+      }
+      for (int j=1; j<n; j++)
+        av[j] = std::min(av[j],av[j-1]);
+      for (int j=n; j--; ) {
+        if ((j+1 < n) && (s[e[j]].est == s[e[j+1]].est))
+          av[j] = av[j+1];
+        const TTEFTask& i = s[e[j]];
+        if ((i.lct <= b) || (i.est >= b) || (i.p == 0) || (i.c == 0) ||
+            (av[j] == LLONG_MAX))
+          continue;
+        // Part of the compulsory part of task i within the window
+        long long int cp = 0;
+        if ((i.lst < i.ect) && (i.lst < b))
+          cp = std::min(i.ect,b) - i.lst;
+        // Maximal length of task i within the window
+        long long int w = (av[j] + i.c * cp) / i.c;
+        if ((i.p > w) && (b - i.est > w))
+          ns[e[j]] = std::max(ns[e[j]],static_cast<int>(b - w));
+      }
+    }
+
+    for (int i=0; i<n; i++)
+      if (ns[i] > s[i].est) {
+        if (fwd) {
+          GECODE_ME_CHECK(t[i].est(home,ns[i]));
+        } else {
+          GECODE_ME_CHECK(t[i].lct(home,-ns[i]));
+        }
+        mod = true;
+      }
+    return ES_OK;
+  }
+
+  template<class ManTask, class Cap>
+  ExecStatus
+  TTEF<ManTask,Cap>::propagate(Space& home, const ModEventDelta&) {
+    int n = t.size();
+    Region r;
+
+    profile(r);
+
+    // Check that the profile does not exceed the capacity
+    for (int i=0; i<np; i++)
+      if (ps[i].h > c.max())
+        return ES_FAILED;
+
+    // Take snapshots of the tasks for both directions
+    TTEFTask* f = r.alloc<TTEFTask>(n);
+    TTEFTask* b = r.alloc<TTEFTask>(n);
+    bool assigned = true;
+    for (int i=0; i<n; i++) {
+      if (!t[i].assigned())
+        assigned = false;
+      f[i].est = t[i].est(); f[i].lct = t[i].lct();
+      f[i].lst = cl[i]; f[i].ect = cu[i];
+      f[i].p = t[i].pmin(); f[i].c = t[i].c();
+      // Energy of the free part
+      f[i].e = static_cast<long long int>(f[i].c) *
+        std::max(0, f[i].p - (f[i].ect - f[i].lst));
+      b[i].est = -f[i].lct; b[i].lct = -f[i].est;
+      b[i].lst = -f[i].ect; b[i].ect = -f[i].lst;
+      b[i].p = f[i].p; b[i].c = f[i].c; b[i].e = f[i].e;
+    }
+
+    if (assigned)
+      return home.ES_SUBSUMED(*this);
+
+    bool mod = false;
+    GECODE_ES_CHECK(ttef(home,r,f,true,mod));
+    GECODE_ES_CHECK(ttef(home,r,b,false,mod));
+
+    return mod ? ES_NOFIX : ES_FIX;
+  }
+
+}}}
+
+// STATISTICS: int-prop
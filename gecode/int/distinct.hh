@@ -312,6 +312,71 @@ namespace Gecode { namespace Int { namespace Distinct {
     static ExecStatus post(Home home, ViewArray<View>& x);
   };
 
+  /// Minimal number of views for incremental domain consistent distinct
+  const int inc_min_views = 32;
+
+  /**
+   * \brief Incremental domain consistent distinct propagator
+   *
+   * Keeps a maximum matching and a partition of the views into
+   * components with disjoint values between executions. Only the
+   * components that contain views with changed domains are matched
+   * again and decomposed into strongly connected components. The
+   * view-value graph is represented by flat arrays over the values,
+   * hence the propagator is used for views with dense values.
+   *
+   * Requires \code #include <gecode/int/distinct.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class View>
+  class IncDom : public NaryPropagator<View,PC_INT_DOM> {
+  protected:
+    using NaryPropagator<View,PC_INT_DOM>::x;
+    /// Smallest value
+    int min;
+    /// Number of values
+    int w;
+    /// Matched value (relative to \a min) of each view, -1 if none
+    int* mv;
+    /// Matched view of each value, -1 if none
+    int* vm;
+    /// Component of each view, identified by one of its matched values
+    int* cp;
+    /// Domain size of each view after the last domain propagation
+    unsigned int* sz;
+    /// Constructor for cloning \a p
+    IncDom(Space& home, IncDom<View>& p);
+    /// Constructor for posting with values from \a min to \a min+w-1
+    IncDom(Home home, ViewArray<View>& x, int min, int w);
+    /// Remove values of assigned views from all other views and drop them
+    ExecStatus val(Space& home);
+    /// Perform domain propagation for changed components
+    ExecStatus dom(Space& home);
+  public:
+#ifdef GECODE_HAS_CBS
+    /// Solution distribution computation for branching
+    virtual void solndistrib(Space& home, Propagator::SendMarginal send) const;
+    /// Sum of variables cardinalities
+    virtual void domainsizesum(Propagator::InDecision in,
+                               unsigned int& size, unsigned int& size_b) const;
+#endif
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /**
+     * \brief Cost function
+     *
+     * If in stage for naive value propagation, the cost is
+     * low linear. Otherwise it is low quadratic.
+     */
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Copy propagator during cloning
+    virtual Actor* copy(Space& home);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+    /// Post propagator for views \a x with values from \a min to \a max
+    static ExecStatus post(Home home, ViewArray<View>& x, int min, int max);
+  };
+
   /**
    * \brief Ternary domain consistent distinct propagator
    *
@@ -379,6 +444,7 @@ namespace Gecode { namespace Int { namespace Distinct {
 #include <gecode/int/distinct/graph.hpp>
 #include <gecode/int/distinct/dom-ctrl.hpp>
 #include <gecode/int/distinct/dom.hpp>
+#include <gecode/int/distinct/inc-dom.hpp>
 #include <gecode/int/distinct/eqite.hpp>
 
 #endif
@@ -50,6 +50,16 @@ namespace Gecode { namespace Int { namespace Distinct {
     if (x.size() > 3) {
       // Do bounds propagation to make view-value graph smaller
       GECODE_ES_CHECK(prop_bnd<View>(home,x));
+      if (x.size() >= inc_min_views) {
+        int min = x[0].min(), max = x[0].max();
+        for (int i=1; i<x.size(); i++) {
+          min = std::min(min,x[i].min());
+          max = std::max(max,x[i].max());
+        }
+        // Use flat arrays if values are dense
+        if (static_cast<long long int>(max) - min < 2LL * x.size())
+          return IncDom<View>::post(home,x,min,max);
+      }
       (void) new (home) Dom<View>(home,x);
     }
     return ES_OK;
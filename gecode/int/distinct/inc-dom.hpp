@@ -0,0 +1,391 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Int { namespace Distinct {
+
+  template<class View>
+  forceinline
+  IncDom<View>::IncDom(Home home, ViewArray<View>& x, int min0, int w0)
+    : NaryPropagator<View,PC_INT_DOM>(home,x), min(min0), w(w0),
+      mv(static_cast<Space&>(home).alloc<int>(x.size())),
+      vm(static_cast<Space&>(home).alloc<int>(w0)),
+      cp(static_cast<Space&>(home).alloc<int>(x.size())),
+      sz(static_cast<Space&>(home).alloc<unsigned int>(x.size())) {
+    // All views are in a single component that has changed
+    for (int i=0; i<x.size(); i++) {
+      mv[i] = -1; cp[i] = 0; sz[i] = 0U;
+    }
+    for (int u=0; u<w; u++)
+      vm[u] = -1;
+  }
+
+  template<class View>
+  ExecStatus
+  IncDom<View>::post(Home home, ViewArray<View>& x, int min, int max) {
+    (void) new (home) IncDom<View>(home,x,min,max-min+1);
+    return ES_OK;
+  }
+
+  template<class View>
+  forceinline
+  IncDom<View>::IncDom(Space& home, IncDom<View>& p)
+    : NaryPropagator<View,PC_INT_DOM>(home,p), min(p.min), w(p.w),
+      mv(home.alloc<int>(p.x.size())), vm(home.alloc<int>(p.w)),
+      cp(home.alloc<int>(p.x.size())),
+      sz(home.alloc<unsigned int>(p.x.size())) {
+    for (int i=0; i<x.size(); i++) {
+      mv[i] = p.mv[i]; cp[i] = p.cp[i]; sz[i] = p.sz[i];
+    }
+    for (int u=0; u<w; u++)
+      vm[u] = p.vm[u];
+  }
+
+  template<class View>
+  Actor*
+  IncDom<View>::copy(Space& home) {
+    return new (home) IncDom<View>(home,*this);
+  }
+
+  template<class View>
+  PropCost
+  IncDom<View>::cost(const Space&, const ModEventDelta& med) const {
+    if (View::me(med) == ME_INT_VAL)
+      return PropCost::linear(PropCost::LO, x.size());
+    else
+      return PropCost::quadratic(PropCost::LO, x.size());
+  }
+
+  template<class View>
+  forceinline size_t
+  IncDom<View>::dispose(Space& home) {
+    home.free<int>(mv,x.size());
+    home.free<int>(vm,w);
+    home.free<int>(cp,x.size());
+    home.free<unsigned int>(sz,x.size());
+    (void) NaryPropagator<View,PC_INT_DOM>::dispose(home);
+    return sizeof(*this);
+  }
+
+#ifdef GECODE_HAS_CBS
+  template<class View>
+  void
+  IncDom<View>::solndistrib(Space& home,
+                            Propagator::SendMarginal send) const {
+    cbsdistinct(home,this->id(),x,send);
+  }
+
+  template<class View>
+  void
+  IncDom<View>::domainsizesum(Propagator::InDecision in, unsigned int& size,
+                              unsigned int& size_b) const {
+    cbssize(x,in,size,size_b);
+  }
+#endif
+
+  template<class View>
+  ExecStatus
+  IncDom<View>::val(Space& home) {
+    int n = x.size();
+    Region r;
+    // Assigned views whose values must be removed from all other views
+    int* s = r.alloc<int>(n);
+    int ns = 0;
+    for (int i=0; i<n; i++)
+      if ((cp[i] >= 0) && x[i].assigned())
+        s[ns++] = i;
+    while (ns > 0) {
+      int i = s[--ns];
+      cp[i] = -1;
+      int v = x[i].val();
+      for (int j=0; j<n; j++)
+        if (cp[j] >= 0) {
+          ModEvent me = x[j].nq(home,v);
+          if (me_failed(me))
+            return ES_FAILED;
+          if (me == ME_INT_VAL)
+            s[ns++] = j;
+        }
+    }
+    // Drop assigned views, their values are not in any other view
+    for (int i=n; i--; )
+      if (cp[i] < 0) {
+        if (mv[i] >= 0)
+          vm[mv[i]] = -1;
+        if (i < --n) {
+          x[i] = x[n]; mv[i] = mv[n]; cp[i] = cp[n]; sz[i] = sz[n];
+          if (mv[i] >= 0)
+            vm[mv[i]] = i;
+        }
+      }
+    x.size(n);
+    return ES_OK;
+  }
+
+  template<class View>
+  ExecStatus
+  IncDom<View>::dom(Space& home) {
+    int n = x.size();
+    Region r;
+
+    // Find components that contain views with changed domains
+    bool* ch = r.alloc<bool>(w);
+    for (int u=0; u<w; u++)
+      ch[u] = false;
+    for (int i=0; i<n; i++)
+      if (x[i].size() != sz[i])
+        ch[cp[i]] = true;
+
+    // Views of changed components and their local index
+    int* d = r.alloc<int>(n);
+    int* l = r.alloc<int>(n);
+    int nd = 0;
+    for (int i=0; i<n; i++)
+      if (ch[cp[i]]) {
+        l[i] = nd; d[nd++] = i;
+      } else {
+        l[i] = -1;
+      }
+    if (nd == 0)
+      return ES_OK;
+
+    // Edges from views to values: e[eo[a]] ... e[eo[a+1]-1] for view a
+    int* eo = r.alloc<int>(nd+1);
+    int ne = 0;
+    for (int a=0; a<nd; a++) {
+      eo[a] = ne; ne += static_cast<int>(x[d[a]].size());
+    }
+    eo[nd] = ne;
+    int* e = r.alloc<int>(ne);
+    // Whether a value has an edge
+    bool* pv = r.alloc<bool>(w);
+    for (int u=0; u<w; u++)
+      pv[u] = false;
+    for (int a=0; a<nd; a++) {
+      int i = d[a];
+      int k = eo[a];
+      bool m = false;
+      for (ViewRanges<View> xa(x[i]); xa(); ++xa)
+        for (int u=xa.min()-min; u<=xa.max()-min; u++) {
+          e[k++] = u; pv[u] = true;
+          if (u == mv[i])
+            m = true;
+        }
+      // Remove matching edge if it has been deleted
+      if (!m && (mv[i] >= 0)) {
+        vm[mv[i]] = -1; mv[i] = -1;
+      }
+    }
+
+    // Stack of views and their next edge for depth-first search
+    int* sv = r.alloc<int>(nd);
+    int* se = r.alloc<int>(nd);
+
+    // Repair the matching by augmenting paths
+    {
+      int* vs = r.alloc<int>(w);
+      for (int u=0; u<w; u++)
+        vs[u] = 0;
+      int stamp = 0;
+      for (int a=0; a<nd; a++)
+        if (mv[d[a]] < 0) {
+          stamp++;
+          int t = 0;
+          sv[t] = a; se[t] = eo[a]; t++;
+          bool found = false;
+          while (t > 0) {
+            int b = sv[t-1];
+            if (se[t-1] == eo[b+1]) {
+              t--; continue;
+            }
+            int u = e[se[t-1]++];
+            if (vs[u] == stamp)
+              continue;
+            vs[u] = stamp;
+            if (vm[u] < 0) {
+              // Flip the edges along the path
+              while (t > 0) {
+                int i = d[sv[--t]];
+                int o = mv[i];
+                mv[i] = u; vm[u] = i;
+                u = o;
+              }
+              found = true;
+              break;
+            }
+            assert(l[vm[u]] >= 0);
+            sv[t] = l[vm[u]]; se[t] = eo[sv[t]]; t++;
+          }
+          if (!found)
+            return ES_FAILED;
+        }
+    }
+
+    // Views reachable by alternating paths from free values
+    bool* f = r.alloc<bool>(nd);
+    for (int a=0; a<nd; a++)
+      f[a] = false;
+    bool fv = false;
+    for (int u=0; u<w; u++)
+      if (pv[u] && (vm[u] < 0)) {
+        fv = true; break;
+      }
+    if (fv) {
+      // Views with an edge to a value: o[vo[u]] ... o[vo[u+1]-1]
+      int* vo = r.alloc<int>(w+1);
+      for (int u=0; u<=w; u++)
+        vo[u] = 0;
+      for (int k=0; k<ne; k++)
+        vo[e[k]+1]++;
+      for (int u=0; u<w; u++)
+        vo[u+1] += vo[u];
+      int* c = r.alloc<int>(w);
+      for (int u=0; u<w; u++)
+        c[u] = vo[u];
+      int* o = r.alloc<int>(ne);
+      for (int a=0; a<nd; a++)
+        for (int k=eo[a]; k<eo[a+1]; k++)
+          o[c[e[k]]++] = a;
+
+      bool* vv = r.alloc<bool>(w);
+      int* q = r.alloc<int>(w);
+      int nq = 0;
+      for (int u=0; u<w; u++) {
+        vv[u] = pv[u] && (vm[u] < 0);
+        if (vv[u])
+          q[nq++] = u;
+      }
+      while (nq > 0) {
+        int u = q[--nq];
+        for (int k=vo[u]; k<vo[u+1]; k++)
+          if (!f[o[k]]) {
+            f[o[k]] = true;
+            int m = mv[d[o[k]]];
+            if (!vv[m]) {
+              vv[m] = true; q[nq++] = m;
+            }
+          }
+      }
+    }
+
+    // New component of each view and number of components
+    int* sc = r.alloc<int>(nd);
+    int nc = 0;
+    for (int a=0; a<nd; a++)
+      if (f[a]) {
+        int fc = mv[d[a]];
+        nc++;
+        for (int b=a; b<nd; b++)
+          if (f[b])
+            sc[b] = fc;
+        break;
+      }
+
+    // Strongly connected components of the remaining views
+    {
+      int* ix = r.alloc<int>(nd);
+      int* lw = r.alloc<int>(nd);
+      int* ts = r.alloc<int>(nd);
+      bool* os = r.alloc<bool>(nd);
+      for (int a=0; a<nd; a++) {
+        ix[a] = -1; os[a] = false;
+      }
+      int nt = 0, c = 0;
+      for (int a=0; a<nd; a++)
+        if (!f[a] && (ix[a] < 0)) {
+          int t = 0;
+          ix[a] = lw[a] = c++; ts[nt++] = a; os[a] = true;
+          sv[t] = a; se[t] = eo[a]; t++;
+          while (t > 0) {
+            int b = sv[t-1];
+            if (se[t-1] < eo[b+1]) {
+              int u = e[se[t-1]++];
+              if (u == mv[d[b]])
+                continue;
+              // Only views reachable from free values have free values
+              int g = l[vm[u]];
+              if (ix[g] < 0) {
+                ix[g] = lw[g] = c++; ts[nt++] = g; os[g] = true;
+                sv[t] = g; se[t] = eo[g]; t++;
+              } else if (os[g]) {
+                lw[b] = std::min(lw[b],ix[g]);
+              }
+            } else {
+              t--;
+              if (lw[b] == ix[b]) {
+                int g;
+                nc++;
+                do {
+                  g = ts[--nt]; os[g] = false; sc[g] = mv[d[b]];
+                } while (g != b);
+              }
+              if (t > 0)
+                lw[sv[t-1]] = std::min(lw[sv[t-1]],lw[b]);
+            }
+          }
+        }
+    }
+
+    // Prune edges between different components
+    int* rv = r.alloc<int>(w);
+    for (int a=0; (nc > 1) && (a<nd); a++) {
+      int i = d[a];
+      int nr = 0;
+      for (int k=eo[a]; k<eo[a+1]; k++) {
+        int u = e[k];
+        if ((u != mv[i]) && (vm[u] >= 0) && (sc[l[vm[u]]] != sc[a]))
+          rv[nr++] = u + min;
+      }
+      if (nr > 0) {
+        Iter::Values::Array v(rv,nr);
+        GECODE_ME_CHECK(x[i].minus_v(home,v,false));
+      }
+    }
+    for (int a=0; a<nd; a++) {
+      cp[d[a]] = sc[a]; sz[d[a]] = x[d[a]].size();
+    }
+    return ES_OK;
+  }
+
+  template<class View>
+  ExecStatus
+  IncDom<View>::propagate(Space& home, const ModEventDelta& med) {
+    if (View::me(med) == ME_INT_VAL) {
+      GECODE_ES_CHECK(val(home));
+      if (x.size() < 2)
+        return home.ES_SUBSUMED(*this);
+      return home.ES_FIX_PARTIAL(*this,View::med(ME_INT_DOM));
+    }
+    GECODE_ES_CHECK(dom(home));
+    for (int i=0; i<x.size(); i++)
+      if (!x[i].assigned())
+        return ES_FIX;
+    return home.ES_SUBSUMED(*this);
+  }
+
+}}}
+
+// STATISTICS: int-prop
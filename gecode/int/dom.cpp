@@ -57,6 +57,20 @@ namespace Gecode {
     }
   }
 
+  void
+  dom(Home home, const IntVarArgs& x, const IntArgs& n, IntPropLevel) {
+    using namespace Int;
+    if (x.size() != n.size())
+      throw ArgumentSizeMismatch("Int::dom");
+    for (int i=0; i<n.size(); i++)
+      Limits::check(n[i],"Int::dom");
+    GECODE_POST;
+    for (int i=0; i<x.size(); i++) {
+      IntView xv(x[i]);
+      GECODE_ME_FAIL(xv.eq(home,n[i]));
+    }
+  }
+
   void
   dom(Home home, IntVar x, int min, int max, IntPropLevel) {
     using namespace Int;
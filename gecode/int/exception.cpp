@@ -80,6 +80,9 @@ namespace Gecode { namespace Int {
   AlreadyFinalized::AlreadyFinalized(const char* l)
     : Exception(l,"Tuple set already finalized") {}
 
+  InvalidTupleSetFile::InvalidTupleSetFile(const char* l)
+    : Exception(l,"Tuple set file cannot be accessed or is invalid") {}
+
   LDSBUnbranchedVariable::LDSBUnbranchedVariable(const char* l)
     : Exception(l,"Variable in symmetry not branched on") {}
 
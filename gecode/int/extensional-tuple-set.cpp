@@ -37,11 +37,41 @@
 
 #include <gecode/int/extensional.hh>
 
+namespace Gecode { namespace Int { namespace Extensional {
+
+  /// Test whether positive tuple set \a t is propagated as an MDD
+  forceinline bool
+  mdd(const TupleSet& t, IntPropLevel ipl) {
+    switch (ba(ipl)) {
+    case IPL_BASIC:
+      return false;
+    case IPL_ADVANCED:
+      return t.tuples() > 0;
+    default:
+      break;
+    }
+    if ((t.tuples() <= 1) || (t.arity() <= 1))
+      return false;
+    // Number of words required for supports by compact-table
+    double w = 0.0;
+    for (int i=0; i<t.arity(); i++)
+      for (TupleSet::Ranges r(t,i); r(); ++r)
+        w += static_cast<double>(r.width());
+    w *= static_cast<double>(t.words());
+    // Small tables always use compact-table
+    if (w < 65536.0)
+      return false;
+    // Use the MDD only if it is much smaller than the supports
+    return 16.0 * static_cast<double>(t.mdd().n_transitions()) < w;
+  }
+
+}}}
+
 namespace Gecode {
 
   void
   extensional(Home home, const IntVarArgs& x, const TupleSet& t, bool pos,
-              IntPropLevel) {
+              IntPropLevel ipl) {
     using namespace Int;
     if (!t.finalized())
       throw NotYetFinalized("Int::extensional");
@@ -51,6 +81,11 @@ namespace Gecode {
       throw ArgumentSame("Int::extensional");
     GECODE_POST;
 
+    if (pos && Extensional::mdd(t,ipl)) {
+      GECODE_ES_FAIL(Extensional::post_lgp(home,x,t.mdd()));
+      return;
+    }
+
     ViewArray<IntView> xv(home,x);
     if (pos)
       GECODE_ES_FAIL((Extensional::postposcompact<IntView>(home,xv,t)));
@@ -110,7 +145,7 @@ namespace Gecode {
 
   void
   extensional(Home home, const BoolVarArgs& x, const TupleSet& t, bool pos,
-              IntPropLevel) {
+              IntPropLevel ipl) {
     using namespace Int;
     if (!t.finalized())
       throw NotYetFinalized("Int::extensional");
@@ -122,6 +157,11 @@ namespace Gecode {
       throw ArgumentSame("Int::extensional");
     GECODE_POST;
 
+    if (pos && Extensional::mdd(t,ipl)) {
+      GECODE_ES_FAIL(Extensional::post_lgp(home,x,t.mdd()));
+      return;
+    }
+
     ViewArray<BoolView> xv(home,x);
     if (pos)
       GECODE_ES_FAIL((Extensional::postposcompact<BoolView>(home,xv,t)));
@@ -42,6 +42,16 @@
 
 #include <gecode/int/rel.hh>
 
+/*
+ * Vectorized bit-set kernels are selected at runtime and require
+ * compiler support for per-function target attributes.
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define GECODE_INT_EXTENSIONAL_AVX2
+#include <immintrin.h>
+#define GECODE_INT_AVX2 __attribute__ ((__target__ ("avx2")))
+#endif
+
 /**
  * \namespace Gecode::Int::Extensional
  * \brief %Extensional propagators
@@ -225,6 +235,22 @@ namespace Gecode { namespace Int { namespace Extensional {
   /// Import type
   typedef Gecode::Support::BitSetData BitSetData;
 
+  /// Kernels for word-wise operations on bit-sets
+  enum BitSetKernel {
+    BSK_SCALAR, ///< Process one word at a time
+    BSK_AVX2    ///< Process four words at a time using AVX2
+  };
+  /// Return kernel used for bit-set operations (best kernel supported by the CPU by default)
+  GECODE_INT_EXPORT BitSetKernel bitset_kernel(void);
+  /**
+   * \brief Use kernel \a k for bit-set operations
+   *
+   * If the CPU does not support \a k, the scalar kernel is used.
+   * Returns the kernel used from now on. Intended for benchmarking,
+   * must not be called while propagators are running.
+   */
+  GECODE_INT_EXPORT BitSetKernel bitset_kernel(BitSetKernel k);
+
   /*
    * Forward declarations
    */
@@ -244,6 +270,21 @@ namespace Gecode { namespace Int { namespace Extensional {
     BitSetData* _bits;
     /// Replace the \a i th word with \a w, decrease \a limit if \a w is zero
     void replace_and_decrease(IndexType i, BitSetData w);
+#ifdef GECODE_INT_EXTENSIONAL_AVX2
+    /// Minimal number of words for using the AVX2 kernels
+    static const unsigned int avx2_limit = 8U;
+    /// Add \b to \a mask (AVX2 kernel)
+    void add_to_mask_avx2(const BitSetData* b, BitSetData* mask) const;
+    /// Intersect with \a mask, sparse mask if \a sparse is true (AVX2 kernel)
+    template<bool sparse>
+    void intersect_with_mask_avx2(const BitSetData* mask);
+    /// Intersect with the "or" of \a and \a b (AVX2 kernel)
+    void intersect_with_masks_avx2(const BitSetData* a, const BitSetData* b);
+    /// Check if \a has a non-empty intersection with the set (AVX2 kernel)
+    bool intersects_avx2(const BitSetData* b) const;
+    /// Perform "nand" with \a b (AVX2 kernel)
+    void nand_with_mask_avx2(const BitSetData* b);
+#endif
   public:
     /// Initialize bit set for a number of words \a n
     BitSet(Space& home, unsigned int n);
@@ -158,6 +158,12 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline void
   BitSet<IndexType>::add_to_mask(const BitSetData* b, BitSetData* mask) const {
     assert(_limit > 0U);
+#ifdef GECODE_INT_EXTENSIONAL_AVX2
+    if ((_limit >= avx2_limit) && (bitset_kernel() == BSK_AVX2)) {
+      add_to_mask_avx2(b,mask);
+      return;
+    }
+#endif
     for (IndexType i=0; i<_limit; i++)
       mask[i] = BitSetData::o(mask[i],b[_index[i]]);
   }
@@ -167,6 +173,12 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline void
   BitSet<IndexType>::intersect_with_mask(const BitSetData* mask) {
     assert(_limit > 0U);
+#ifdef GECODE_INT_EXTENSIONAL_AVX2
+    if ((_limit >= avx2_limit) && (bitset_kernel() == BSK_AVX2)) {
+      intersect_with_mask_avx2<sparse>(mask);
+      return;
+    }
+#endif
     if (sparse) {
       for (IndexType i = _limit; i--; ) {
         assert(!_bits[i].none());
@@ -191,6 +203,12 @@ namespace Gecode { namespace Int { namespace Extensional {
   BitSet<IndexType>::intersect_with_masks(const BitSetData* a,
                                           const BitSetData* b) {
     assert(_limit > 0U);
+#ifdef GECODE_INT_EXTENSIONAL_AVX2
+    if ((_limit >= avx2_limit) && (bitset_kernel() == BSK_AVX2)) {
+      intersect_with_masks_avx2(a,b);
+      return;
+    }
+#endif
     for (IndexType i = _limit; i--; ) {
       assert(!_bits[i].none());
       BitSetData w_i = _bits[i];
@@ -206,6 +224,12 @@ namespace Gecode { namespace Int { namespace Extensional {
   forceinline void
   BitSet<IndexType>::nand_with_mask(const BitSetData* b) {
     assert(_limit > 0U);
+#ifdef GECODE_INT_EXTENSIONAL_AVX2
+    if ((_limit >= avx2_limit) && (bitset_kernel() == BSK_AVX2)) {
+      nand_with_mask_avx2(b);
+      return;
+    }
+#endif
     for (IndexType i = _limit; i--; ) {
       assert(!_bits[i].none());
       BitSetData w = BitSetData::a(_bits[i],~(b[_index[i]]));
@@ -217,6 +241,10 @@ namespace Gecode { namespace Int { namespace Extensional {
   template<class IndexType>
   forceinline bool
   BitSet<IndexType>::intersects(const BitSetData* b) const {
+#ifdef GECODE_INT_EXTENSIONAL_AVX2
+    if ((_limit >= avx2_limit) && (bitset_kernel() == BSK_AVX2))
+      return intersects_avx2(b);
+#endif
     for (IndexType i=0; i<_limit; i++)
       if (!BitSetData::a(_bits[i],b[_index[i]]).none())
         return true;
@@ -249,6 +277,142 @@ namespace Gecode { namespace Int { namespace Extensional {
             static_cast<unsigned long long int>(BitSetData::bpb));
   }
 
+#ifdef GECODE_INT_EXTENSIONAL_AVX2
+
+  /*
+   * AVX2 kernels
+   *
+   * The kernels process blocks of four words. Words are accessed
+   * through their index by gather instructions. Intersection first
+   * checks whether a block changes at all: only then the words are
+   * processed one by one exactly as by the scalar kernels, as removing
+   * a word moves the last word into its place.
+   *
+   */
+
+  /// Load four words from \a b at positions \a i
+  template<class IndexType>
+  GECODE_INT_AVX2 inline __m256i
+  avx2_gather(const BitSetData* b, const IndexType* i) {
+    __m128i j = _mm_setr_epi32(static_cast<int>(i[0]),
+                               static_cast<int>(i[1]),
+                               static_cast<int>(i[2]),
+                               static_cast<int>(i[3]));
+    return _mm256_i32gather_epi64
+      (reinterpret_cast<const long long int*>(b), j, 8);
+  }
+  /// Load four words from \a b
+  GECODE_INT_AVX2 inline __m256i
+  avx2_load(const BitSetData* b) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b));
+  }
+  /// Test whether all words in \a a and \a b are equal
+  GECODE_INT_AVX2 inline bool
+  avx2_equal(__m256i a, __m256i b) {
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi64(a,b)) == -1;
+  }
+
+  template<class IndexType>
+  GECODE_INT_AVX2 void
+  BitSet<IndexType>::add_to_mask_avx2(const BitSetData* b,
+                                      BitSetData* mask) const {
+    static_assert(sizeof(BitSetData) == sizeof(long long int),
+                  "Words must be 64 bits");
+    unsigned int n = _limit;
+    unsigned int i = 0U;
+    for (; i+4U <= n; i += 4U) {
+      __m256i o = _mm256_or_si256(avx2_load(mask+i),
+                                  avx2_gather(b,_index+i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(mask+i), o);
+    }
+    for (; i<n; i++)
+      mask[i] = BitSetData::o(mask[i],b[_index[i]]);
+  }
+
+  template<class IndexType>
+  template<bool sparse>
+  GECODE_INT_AVX2 void
+  BitSet<IndexType>::intersect_with_mask_avx2(const BitSetData* mask) {
+    unsigned int i = _limit;
+    while (i >= 4U) {
+      i -= 4U;
+      __m256i w = avx2_load(_bits+i);
+      __m256i m = sparse ? avx2_gather(mask,_index+i) : avx2_load(mask+i);
+      if (avx2_equal(_mm256_and_si256(w,m),w))
+        continue;
+      for (unsigned int j=i+4U; j-- > i; ) {
+        BitSetData w_a = BitSetData::a(_bits[j], mask[sparse ? _index[j] : j]);
+        replace_and_decrease(static_cast<IndexType>(j),w_a);
+      }
+    }
+    while (i--) {
+      BitSetData w_a = BitSetData::a(_bits[i], mask[sparse ? _index[i] : i]);
+      replace_and_decrease(static_cast<IndexType>(i),w_a);
+    }
+  }
+
+  template<class IndexType>
+  GECODE_INT_AVX2 void
+  BitSet<IndexType>::intersect_with_masks_avx2(const BitSetData* a,
+                                               const BitSetData* b) {
+    unsigned int i = _limit;
+    while (i >= 4U) {
+      i -= 4U;
+      __m256i w = avx2_load(_bits+i);
+      __m256i m = _mm256_or_si256(avx2_gather(a,_index+i),
+                                  avx2_gather(b,_index+i));
+      if (avx2_equal(_mm256_and_si256(w,m),w))
+        continue;
+      for (unsigned int j=i+4U; j-- > i; ) {
+        IndexType o = _index[j];
+        BitSetData w_a = BitSetData::a(_bits[j], BitSetData::o(a[o],b[o]));
+        replace_and_decrease(static_cast<IndexType>(j),w_a);
+      }
+    }
+    while (i--) {
+      IndexType o = _index[i];
+      BitSetData w_a = BitSetData::a(_bits[i], BitSetData::o(a[o],b[o]));
+      replace_and_decrease(static_cast<IndexType>(i),w_a);
+    }
+  }
+
+  template<class IndexType>
+  GECODE_INT_AVX2 bool
+  BitSet<IndexType>::intersects_avx2(const BitSetData* b) const {
+    unsigned int n = _limit;
+    unsigned int i = 0U;
+    for (; i+4U <= n; i += 4U)
+      if (!_mm256_testz_si256(avx2_load(_bits+i),avx2_gather(b,_index+i)))
+        return true;
+    for (; i<n; i++)
+      if (!BitSetData::a(_bits[i],b[_index[i]]).none())
+        return true;
+    return false;
+  }
+
+  template<class IndexType>
+  GECODE_INT_AVX2 void
+  BitSet<IndexType>::nand_with_mask_avx2(const BitSetData* b) {
+    unsigned int i = _limit;
+    while (i >= 4U) {
+      i -= 4U;
+      __m256i w = avx2_load(_bits+i);
+      // Nothing to remove if no word intersects
+      if (_mm256_testz_si256(w,avx2_gather(b,_index+i)))
+        continue;
+      for (unsigned int j=i+4U; j-- > i; ) {
+        BitSetData w_n = BitSetData::a(_bits[j],~(b[_index[j]]));
+        replace_and_decrease(static_cast<IndexType>(j),w_n);
+      }
+    }
+    while (i--) {
+      BitSetData w_n = BitSetData::a(_bits[i],~(b[_index[i]]));
+      replace_and_decrease(static_cast<IndexType>(i),w_n);
+    }
+  }
+
+#endif
+
 }}}
 
 // STATISTICS: int-prop
@@ -37,6 +37,15 @@
 
 #include <gecode/int.hh>
 #include <algorithm>
+#include <fstream>
+
+#ifdef HAVE_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 namespace Gecode { namespace Int { namespace Extensional {
 
@@ -55,18 +64,6 @@ namespace Gecode { namespace Int { namespace Extensional {
     bool operator ()(const Tuple& a, const Tuple& b);
   };
 
-  /// Tuple comparison by position
-  class PosCompare {
-  private:
-    /// The position of the tuples to compare
-    int p;
-  public:
-    /// Initialize with position \a p
-    PosCompare(int p);
-    /// Comparison of tuples \a a and \a b
-    bool operator ()(const Tuple& a, const Tuple& b);
-  };
-
 
   forceinline
   TupleCompare::TupleCompare(int a) : arity(a) {}
@@ -82,14 +79,261 @@ namespace Gecode { namespace Int { namespace Extensional {
   }
 
 
-  forceinline
-  PosCompare::PosCompare(int p0) : p(p0) {}
+
+
+  /// Header of a file for a finalized tuple set
+  class TupleSetHeader {
+  public:
+    /// Identification of file format and platform
+    unsigned int id[4];
+    /// Arity
+    int arity;
+    /// Number of tuples
+    int n_tuples;
+    /// Number of words for support
+    unsigned int n_words;
+    /// Number of values
+    unsigned int n_vals;
+    /// Number of ranges
+    unsigned int n_ranges;
+    /// Smallest value
+    int min;
+    /// Largest value
+    int max;
+    /// Unused
+    int pad;
+    /// Hash key
+    std::size_t key;
+    /// Initialize identification
+    void init(void);
+    /// Test whether identification is valid
+    bool valid(void) const;
+    /// Offset of tuple data
+    std::size_t tuples(void) const;
+    /// Offset of number of ranges per position
+    std::size_t n(void) const;
+    /// Offset of ranges
+    std::size_t ranges(void) const;
+    /// Offset of supports
+    std::size_t supports(void) const;
+    /// Size of file
+    std::size_t size(void) const;
+  };
+
+  /// Round \a n up to a multiple of the size of bit set data
+  forceinline std::size_t
+  align(std::size_t n) {
+    const std::size_t a = sizeof(Support::BitSetData);
+    return ((n + a - 1) / a) * a;
+  }
+
+  forceinline void
+  TupleSetHeader::init(void) {
+    id[0] = 0x54534547U; // Magic number
+    id[1] = 1U;          // Version
+    id[2] = static_cast<unsigned int>(sizeof(Support::BitSetData) |
+                                      (sizeof(std::size_t) << 8));
+    id[3] = 0x01020304U; // Byte order
+    pad = 0;
+  }
+  forceinline bool
+  TupleSetHeader::valid(void) const {
+    TupleSetHeader h; h.init();
+    for (int i=0; i<4; i++)
+      if (id[i] != h.id[i])
+        return false;
+    return (arity > 0) && (n_tuples >= 0);
+  }
+  forceinline std::size_t
+  TupleSetHeader::tuples(void) const {
+    return align(sizeof(TupleSetHeader));
+  }
+  forceinline std::size_t
+  TupleSetHeader::n(void) const {
+    return tuples() + static_cast<std::size_t>(n_tuples) * arity * sizeof(int);
+  }
+  forceinline std::size_t
+  TupleSetHeader::ranges(void) const {
+    return n() + static_cast<std::size_t>(arity) * sizeof(unsigned int);
+  }
+  forceinline std::size_t
+  TupleSetHeader::supports(void) const {
+    return align(ranges() + static_cast<std::size_t>(n_ranges) * 2 *
+                 sizeof(int));
+  }
+  forceinline std::size_t
+  TupleSetHeader::size(void) const {
+    if (n_tuples == 0)
+      return tuples();
+    return supports() + static_cast<std::size_t>(n_words) * n_vals *
+      sizeof(Support::BitSetData);
+  }
+
+
+  /// Write zero bytes to \a os up to offset \a o
+  forceinline void
+  pad(std::ostream& os, std::size_t o) {
+    while (static_cast<std::size_t>(os.tellp()) < o)
+      os.put(0);
+  }
+
+
+  /// Incremental construction of a reduced MDD from sorted tuples
+  class MDDBuilder {
+  protected:
+    /// Arity of tuples
+    int arity;
+    /// Transitions of registered nodes
+    Support::DynamicArray<DFA::Transition,Heap> trans;
+    /// Number of transitions
+    int n_trans;
+    /// First transition of each registered node
+    Support::DynamicArray<int,Heap> fst;
+    /// Number of registered nodes (node zero is the final node)
+    int n_nodes;
+    /// Hash table for registered nodes (zero marks an empty entry)
+    int* table;
+    /// Size of hash table minus one
+    int mask;
+    /// Values of edges of open nodes
+    int* ov;
+    /// Targets of edges of open nodes
+    int* oc;
+    /// First edge of open node at position
+    int* of;
+    /// Number of edges of open node at position
+    int* on;
+    /// Hash key of open node at position \a i
+    std::size_t hash(int i) const;
+    /// Hash key of registered node \a j
+    std::size_t key(int j) const;
+    /// Test whether open node at position \a i is equal to node \a j
+    bool same(int i, int j) const;
+    /// Insert registered node \a j into hash table
+    void insert(int j);
+    /// Register open node at position \a i and return its node
+    int reg(int i);
+  public:
+    /// Initialize for arity \a a and \a n[i] values at position \a i
+    MDDBuilder(Region& r, int a, const unsigned int* n);
+    /// Add tuple \a t that shares the first \a p values with the last tuple
+    void add(const int* t, int p);
+    /// Return the MDD for all added tuples
+    DFA mdd(void);
+    /// Delete builder
+    ~MDDBuilder(void);
+  };
+
+  forceinline std::size_t
+  MDDBuilder::hash(int i) const {
+    std::size_t h = static_cast<std::size_t>(on[i]);
+    for (int k=of[i]; k<of[i]+on[i]; k++) {
+      cmb_hash(h,ov[k]); cmb_hash(h,oc[k]);
+    }
+    return h;
+  }
+
+  forceinline std::size_t
+  MDDBuilder::key(int j) const {
+    std::size_t h = static_cast<std::size_t>(fst[j+1]-fst[j]);
+    for (int k=fst[j]; k<fst[j+1]; k++) {
+      cmb_hash(h,trans[k].symbol); cmb_hash(h,trans[k].o_state);
+    }
+    return h;
+  }
 
   forceinline bool
-  PosCompare::operator ()(const Tuple& a, const Tuple& b) {
-    return a[p] < b[p];
+  MDDBuilder::same(int i, int j) const {
+    if (on[i] != fst[j+1]-fst[j])
+      return false;
+    for (int k=0; k<on[i]; k++)
+      if ((ov[of[i]+k] != trans[fst[j]+k].symbol) ||
+          (oc[of[i]+k] != trans[fst[j]+k].o_state))
+        return false;
+    return true;
+  }
+
+  forceinline void
+  MDDBuilder::insert(int j) {
+    int k = static_cast<int>(key(j)) & mask;
+    while (table[k] != 0)
+      k = (k+1) & mask;
+    table[k] = j;
+  }
+
+  int
+  MDDBuilder::reg(int i) {
+    int k = static_cast<int>(hash(i)) & mask;
+    while (table[k] != 0) {
+      if (same(i,table[k]))
+        return table[k];
+      k = (k+1) & mask;
+    }
+    // Register as new node
+    int j = n_nodes++;
+    for (int e=of[i]; e<of[i]+on[i]; e++)
+      trans[n_trans++] = DFA::Transition(j,ov[e],oc[e]);
+    fst[n_nodes] = n_trans;
+    table[k] = j;
+    // Keep the hash table at most half full
+    if (2*n_nodes > mask) {
+      heap.rfree(table);
+      mask = 2*mask+1;
+      table = heap.alloc<int>(mask+1);
+      for (int l=0; l<=mask; l++)
+        table[l] = 0;
+      for (int l=1; l<n_nodes; l++)
+        insert(l);
+    }
+    return j;
+  }
+
+  forceinline
+  MDDBuilder::MDDBuilder(Region& r, int a, const unsigned int* n)
+    : arity(a), trans(heap), n_trans(0), fst(heap), n_nodes(1),
+      table(heap.alloc<int>(1024)), mask(1023),
+      of(r.alloc<int>(a)), on(r.alloc<int>(a)) {
+    fst[0] = fst[1] = 0;
+    for (int i=0; i<=mask; i++)
+      table[i] = 0;
+    // An open node has at most as many edges as there are values
+    int m = 0;
+    for (int i=0; i<arity; i++) {
+      of[i] = m; on[i] = 0;
+      m += static_cast<int>(n[i]);
+    }
+    ov = r.alloc<int>(m); oc = r.alloc<int>(m);
+  }
+
+  forceinline void
+  MDDBuilder::add(const int* t, int p) {
+    // Register the open nodes after the shared prefix
+    for (int i=arity-1; i>p; i--) {
+      oc[of[i-1]+on[i-1]-1] = reg(i);
+      on[i] = 0;
+    }
+    // Open nodes for the remaining values
+    for (int i=p; i<arity; i++) {
+      ov[of[i]+on[i]] = t[i];
+      oc[of[i]+on[i]] = (i+1 == arity) ? 0 : -1;
+      on[i]++;
+    }
+  }
+
+  forceinline DFA
+  MDDBuilder::mdd(void) {
+    for (int i=arity-1; i>0; i--)
+      oc[of[i-1]+on[i-1]-1] = reg(i);
+    int root = reg(0);
+    trans[n_trans] = DFA::Transition(-1,0,-1);
+    int f[] = {0,-1};
+    return DFA(root,trans,f,false);
   }
 
+  forceinline
+  MDDBuilder::~MDDBuilder(void) {
+    heap.rfree(table);
+  }
 
 }}}
 
@@ -145,7 +389,6 @@ namespace Gecode {
           new_td[t*arity+a] = tuple[t][a];
           cmb_hash(key,tuple[t][a]);
         }
-        tuple[t] = new_td + t*arity;
       }
       heap.rfree(td);
       td = new_td;
@@ -157,86 +400,56 @@ namespace Gecode {
     // Compute range information
     {
       /*
-       * Pass one: compute how many values and ranges are needed
+       * Pass one: compute the values for all positions, where the
+       * values for position a are v[vf[a]] ... v[vf[a+1]-1]
        */
-      // How many values
-      unsigned int n_vals = 0U;
+      Support::DynamicArray<int,Heap> v(heap);
+      int* vf = r.alloc<int>(arity+1);
+      int* c = r.alloc<int>(n_tuples);
+      int n_v = 0;
       // How many ranges
       unsigned int n_ranges = 0U;
       for (int a=0; a<arity; a++) {
-        // Sort tuple according to position
-        PosCompare pc(a);
-        Support::quicksort(tuple, n_tuples, pc);
-        // Scan values
-        {
-          int max=tuple[0][a];
-          n_vals++; n_ranges++;
-          for (int i=1; i<n_tuples; i++) {
-            assert(tuple[i-1][a] <= tuple[i][a]);
-            if (max+1 == tuple[i][a]) {
-              n_vals++;
-              max=tuple[i][a];
-            } else if (max+1 < tuple[i][a]) {
-              n_vals++; n_ranges++;
-              max=tuple[i][a];
-            } else {
-              assert(max == tuple[i][a]);
-            }
+        // Sort values at position
+        for (int i=0; i<n_tuples; i++)
+          c[i] = td[i*arity+a];
+        Support::quicksort(c, n_tuples);
+        vf[a] = n_v;
+        v[n_v++] = c[0]; n_ranges++;
+        for (int i=1; i<n_tuples; i++)
+          if (c[i-1] != c[i]) {
+            if (c[i-1]+1 != c[i])
+              n_ranges++;
+            v[n_v++] = c[i];
           }
-        }
       }
+      vf[arity] = n_v;
+      n_vals = static_cast<unsigned int>(n_v);
       /*
        * Pass 2: allocate memory and fill data structures
        */
-      // Allocate memory for ranges
+      // Allocate memory for ranges, supports are only computed when needed
       Range* cr = range = heap.alloc<Range>(n_ranges);
-      // Allocate and initialize memory for supports
-      BitSetData* cs = support = heap.alloc<BitSetData>(n_words * n_vals);
-      for (unsigned int i=0; i<n_vals * n_words; i++)
-        cs[i].init();
       for (int a=0; a<arity; a++) {
         // Set range pointer
         vd[a].r = cr;
-        // Sort tuple according to position
-        PosCompare pc(a);
-        Support::quicksort(tuple, n_tuples, pc);
         // Update min and max
-        min = std::min(min,tuple[0][a]);
-        max = std::max(max,tuple[n_tuples-1][a]);
+        min = std::min(min,v[vf[a]]);
+        max = std::max(max,v[vf[a+1]-1]);
         // Compress into non-overlapping ranges
-        {
-          unsigned int j=0U;
-          vd[a].r[0].max=vd[a].r[0].min=tuple[0][a];
-          for (int i=1; i<n_tuples; i++) {
-            assert(tuple[i-1][a] <= tuple[i][a]);
-            if (vd[a].r[j].max+1 == tuple[i][a]) {
-              vd[a].r[j].max=tuple[i][a];
-            } else if (vd[a].r[j].max+1 < tuple[i][a]) {
-              j++; vd[a].r[j].min=vd[a].r[j].max=tuple[i][a];
-            } else {
-              assert(vd[a].r[j].max == tuple[i][a]);
-            }
-          }
-          vd[a].n = j+1U;
-          cr += j+1U;
-        }
-        // Set support pointer and set bits
-        for (unsigned int i=0U; i<vd[a].n; i++) {
-          vd[a].r[i].s = cs;
-          cs += n_words * vd[a].r[i].width();
-        }
-        {
-          int j=0;
-          for (int i=0; i<n_tuples; i++) {
-            while (tuple[i][a] > vd[a].r[j].max)
-              j++;
-            set(const_cast<BitSetData*>
-                (vd[a].r[j].supports(n_words,tuple[i][a])),
-                tuple2idx(tuple[i]));
+        unsigned int j=0U;
+        vd[a].r[0].max=vd[a].r[0].min=v[vf[a]];
+        for (int i=vf[a]+1; i<vf[a+1]; i++)
+          if (vd[a].r[j].max+1 == v[i]) {
+            vd[a].r[j].max=v[i];
+          } else {
+            j++; vd[a].r[j].min=vd[a].r[j].max=v[i];
           }
-        }
+        vd[a].n = j+1U;
+        for (unsigned int i=0U; i<vd[a].n; i++)
+          vd[a].r[i].s = nullptr;
+        cr += j+1U;
       }
-      assert(cs == support + n_words * n_vals);
       assert(cr == range + n_ranges);
     }
     if ((min < Int::Limits::min) || (max > Int::Limits::max))
@@ -244,6 +457,72 @@ namespace Gecode {
     assert(finalized());
   }
 
+  void
+  TupleSet::Data::supports(void) {
+    Support::Lock l(m);
+    if ((support != nullptr) || (n_tuples == 0))
+      return;
+    BitSetData* s = heap.alloc<BitSetData>(n_words * n_vals);
+    for (unsigned int i=0; i<n_vals * n_words; i++)
+      s[i].init();
+    {
+      BitSetData* cs = s;
+      for (int a=0; a<arity; a++)
+        for (unsigned int i=0U; i<vd[a].n; i++) {
+          vd[a].r[i].s = cs;
+          cs += n_words * vd[a].r[i].width();
+        }
+      assert(cs == s + n_words * n_vals);
+    }
+    for (int t=0; t<n_tuples; t++) {
+      Tuple tt = get(t);
+      for (int a=0; a<arity; a++)
+        set(const_cast<BitSetData*>
+            (vd[a].r[vd[a].start(tt[a])].supports(n_words,tt[a])),
+            static_cast<unsigned int>(t));
+    }
+    support = s;
+  }
+
+  void
+  TupleSet::Data::compile(void) {
+    using namespace Int::Extensional;
+    Support::Lock l(m);
+    if (mdd)
+      return;
+    if (n_tuples == 0) {
+      DFA::Transition t[] = {DFA::Transition(-1,0,-1)};
+      int f[] = {-1};
+      mdd = DFA(0,t,f,false);
+      return;
+    }
+    /*
+     * The tuples are sorted lexicographically: each tuple only
+     * requires to register the nodes for the suffix that it does
+     * not share with the previous tuple (this is the incremental
+     * construction of minimal acyclic automata by Daciuk et al.).
+     */
+    Region r;
+    unsigned int* w = r.alloc<unsigned int>(arity);
+    for (int a=0; a<arity; a++) {
+      w[a] = 0U;
+      for (unsigned int i=0U; i<vd[a].n; i++)
+        w[a] += vd[a].r[i].width();
+    }
+    MDDBuilder b(r,arity,w);
+    b.add(get(0),0);
+    for (int t=1; t<n_tuples; t++) {
+      Tuple p = get(t-1);
+      Tuple c = get(t);
+      int i = 0;
+      while (p[i] == c[i])
+        i++;
+      assert(i < arity);
+      b.add(c,i);
+    }
+    mdd = b.mdd();
+  }
+
   void
   TupleSet::Data::resize(void) {
     assert(n_free == 0);
@@ -253,10 +532,18 @@ namespace Gecode {
   }
 
   TupleSet::Data::~Data(void) {
-    heap.rfree(td);
+    if (file != nullptr) {
+#ifdef HAVE_MMAP
+      (void) munmap(file,file_size);
+#else
+      heap.rfree(file);
+#endif
+    } else {
+      heap.rfree(td);
+      heap.rfree(support);
+    }
     heap.rfree(vd);
     heap.rfree(range);
-    heap.rfree(support);
   }
 
 
@@ -278,6 +565,132 @@ namespace Gecode {
     return *this;
   }
 
+  TupleSet::TupleSet(const std::string& fn) {
+    using namespace Int::Extensional;
+    // Read the file
+    char* f;
+    std::size_t n;
+#ifdef HAVE_MMAP
+    {
+      int fd = open(fn.c_str(), O_RDONLY);
+      if (fd == -1)
+        throw Int::InvalidTupleSetFile("TupleSet::TupleSet");
+      struct stat sb;
+      if (fstat(fd, &sb) == -1) {
+        (void) close(fd);
+        throw Int::InvalidTupleSetFile("TupleSet::TupleSet");
+      }
+      n = static_cast<std::size_t>(sb.st_size);
+      void* m = (n > 0) ? mmap(nullptr, n, PROT_READ, MAP_SHARED, fd, 0)
+        : MAP_FAILED;
+      (void) close(fd);
+      if (m == MAP_FAILED)
+        throw Int::InvalidTupleSetFile("TupleSet::TupleSet");
+      f = static_cast<char*>(m);
+    }
+#else
+    {
+      std::ifstream is(fn.c_str(), std::ios::binary | std::ios::ate);
+      if (!is)
+        throw Int::InvalidTupleSetFile("TupleSet::TupleSet");
+      n = static_cast<std::size_t>(is.tellg());
+      f = heap.alloc<char>(n);
+      is.seekg(0);
+      if (!is.read(f, static_cast<std::streamsize>(n))) {
+        heap.rfree(f);
+        throw Int::InvalidTupleSetFile("TupleSet::TupleSet");
+      }
+    }
+#endif
+    const TupleSetHeader& h = *reinterpret_cast<const TupleSetHeader*>(f);
+    if ((n < sizeof(TupleSetHeader)) || !h.valid() || (h.size() != n)) {
+#ifdef HAVE_MMAP
+      (void) munmap(f,n);
+#else
+      heap.rfree(f);
+#endif
+      throw Int::InvalidTupleSetFile("TupleSet::TupleSet");
+    }
+
+    // Tuples and supports stay in the file, only ranges are created
+    Data* d = new Data(h.arity);
+    heap.rfree(d->td);
+    d->file = f; d->file_size = n;
+    d->n_free = -1;
+    d->n_tuples = h.n_tuples;
+    d->n_words = h.n_words;
+    d->n_vals = h.n_vals;
+    d->min = h.min; d->max = h.max;
+    d->key = h.key;
+    d->td = reinterpret_cast<int*>(f + h.tuples());
+    if (h.n_tuples > 0) {
+      d->support = reinterpret_cast<BitSetData*>(f + h.supports());
+      d->range = heap.alloc<Range>(h.n_ranges);
+      const unsigned int* rn =
+        reinterpret_cast<const unsigned int*>(f + h.n());
+      const int* rv = reinterpret_cast<const int*>(f + h.ranges());
+      Range* cr = d->range;
+      BitSetData* cs = d->support;
+      for (int a=0; a<h.arity; a++) {
+        d->vd[a].n = rn[a];
+        d->vd[a].r = cr;
+        for (unsigned int i=0U; i<rn[a]; i++) {
+          cr->min = *rv++; cr->max = *rv++; cr->s = cs;
+          cs += h.n_words * cr->width();
+          cr++;
+        }
+      }
+      assert(cr == d->range + h.n_ranges);
+      assert(cs == d->support + h.n_words * h.n_vals);
+    } else {
+      d->td = nullptr;
+    }
+    object(d);
+  }
+
+  void
+  TupleSet::write(const std::string& fn) const {
+    using namespace Int::Extensional;
+    if (!*this)
+      throw Int::UninitializedTupleSet("TupleSet::write()");
+    if (!raw().finalized())
+      throw Int::NotYetFinalized("TupleSet::write()");
+    Data& d = data();
+    d.supports();
+    TupleSetHeader h;
+    h.init();
+    h.arity = d.arity;
+    h.n_tuples = d.n_tuples;
+    h.n_words = d.n_words;
+    h.n_vals = d.n_vals;
+    h.n_ranges = 0U;
+    if (d.n_tuples > 0)
+      for (int a=0; a<d.arity; a++)
+        h.n_ranges += d.vd[a].n;
+    h.min = d.min; h.max = d.max;
+    h.key = d.key;
+
+    std::ofstream os(fn.c_str(), std::ios::binary | std::ios::trunc);
+    os.write(reinterpret_cast<const char*>(&h), sizeof(TupleSetHeader));
+    pad(os,h.tuples());
+    if (d.n_tuples > 0) {
+      os.write(reinterpret_cast<const char*>(d.td),
+               static_cast<std::streamsize>(h.n() - h.tuples()));
+      for (int a=0; a<d.arity; a++)
+        os.write(reinterpret_cast<const char*>(&d.vd[a].n),
+                 sizeof(unsigned int));
+      for (unsigned int i=0U; i<h.n_ranges; i++) {
+        os.write(reinterpret_cast<const char*>(&d.range[i].min), sizeof(int));
+        os.write(reinterpret_cast<const char*>(&d.range[i].max), sizeof(int));
+      }
+      pad(os,h.supports());
+      os.write(reinterpret_cast<const char*>(d.support),
+               static_cast<std::streamsize>(h.size() - h.supports()));
+    }
+    if (!os)
+      throw Int::InvalidTupleSetFile("TupleSet::write()");
+  }
+
   TupleSet::TupleSet(int a, const Gecode::DFA& dfa) {
     /// Edges in layered graph
     struct Edge {
@@ -64,7 +64,8 @@ namespace Gecode {
       min(Int::Limits::max), max(Int::Limits::min), key(0),
       td(heap.alloc<int>(n_initial_free * a)),
       vd(heap.alloc<ValueData>(a)),
-      range(nullptr), support(nullptr) {
+      range(nullptr), support(nullptr), n_vals(0U),
+      file(nullptr), file_size(0) {
   }
   
   forceinline bool
@@ -203,12 +204,19 @@ namespace Gecode {
   }
   forceinline const TupleSet::Range*
   TupleSet::fst(int i) const {
+    data().supports();
     return data().fst(i);
   }
   forceinline const TupleSet::Range*
   TupleSet::lst(int i) const {
+    data().supports();
     return data().lst(i);
   }
+  forceinline DFA
+  TupleSet::mdd(void) const {
+    data().compile();
+    return data().mdd;
+  }
 
   forceinline bool
   TupleSet::operator ==(const TupleSet& t) const {
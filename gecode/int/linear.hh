@@ -767,10 +767,149 @@ namespace Gecode { namespace Int { namespace Linear {
     post(Home home, ViewArray<P>& x, ViewArray<N>& y, Val c, BoolView b);
   };
 
+  /**
+   * \brief Minimal number of terms for incremental n-ary linear propagators
+   *
+   * Bounds consistent linear equalities and inequalities with at least
+   * this many terms are propagated by IncEq and IncLq.
+   */
+  const int inc_min_terms = 128;
+
+  /**
+   * \brief Base-class for incremental n-ary linear propagators
+   *
+   * The sums of the minimal and maximal values of all terms are
+   * maintained by advisors from the bound changes of the views. The
+   * propagator is only scheduled if some term is wider than the slack
+   * of the constraint, that is, if some bound can actually be pruned.
+   *
+   * The type \a Val can be either \c long long int or \c int, defining the
+   * numerical precision during propagation. The views in \a x are
+   * positive and the views in \a y are negative terms.
+   */
+  template<class Val, class View>
+  class IncLin : public Propagator {
+  protected:
+    /// %Advisor for a single term
+    class Term : public Advisor {
+    public:
+      /// Position of the view: \f$x_i\f$ if \f$i\geq 0\f$, \f$y_{-i-1}\f$ otherwise
+      int i;
+      /// Minimal and maximal value of the term when last seen
+      Val l, u;
+      /// Create advisor for term \a i with bounds \a l and \a u
+      Term(Space& home, Propagator& p, Council<Term>& c, int i, Val l, Val u);
+      /// Clone advisor \a a
+      Term(Space& home, Term& a);
+    };
+    /// Array of positive views
+    ViewArray<View> x;
+    /// Array of negative views
+    ViewArray<View> y;
+    /// Constant value
+    Val c;
+    /// The advisor council
+    Council<Term> co;
+    /// Sum of minimal and maximal values of all terms
+    Val sl, su;
+    /// Upper bound on the width of all terms
+    Val w;
+    /// Update sums for the term of advisor \a a, return whether it is assigned
+    bool update(Term& a);
+    /// Prune maximal values of the terms with respect to \a sl
+    ExecStatus prune_max(Space& home);
+    /// Prune minimal values of the terms with respect to \a su
+    ExecStatus prune_min(Space& home);
+    /// Constructor for cloning \a p
+    IncLin(Space& home, IncLin<Val,View>& p);
+    /// Constructor for creation
+    IncLin(Home home, ViewArray<View>& x, ViewArray<View>& y, Val c);
+  public:
+    /// Cost function (defined as low linear)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
+  /**
+   * \brief %Propagator for incremental bounds consistent n-ary linear equality
+   *
+   * Requires \code #include <gecode/int/linear.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class Val, class View>
+  class IncEq : public IncLin<Val,View> {
+  protected:
+    using typename IncLin<Val,View>::Term;
+    using IncLin<Val,View>::x;
+    using IncLin<Val,View>::y;
+    using IncLin<Val,View>::c;
+    using IncLin<Val,View>::co;
+    using IncLin<Val,View>::sl;
+    using IncLin<Val,View>::su;
+    using IncLin<Val,View>::w;
+    /// Whether propagation can prune a bound or detect subsumption
+    bool prunable(void) const;
+    /// Constructor for cloning \a p
+    IncEq(Space& home, IncEq& p);
+  public:
+    /// Constructor for creation
+    IncEq(Home home, ViewArray<View>& x, ViewArray<View>& y, Val c);
+    /// Create copy during cloning
+    virtual Actor* copy(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for \f$\sum_{i=0}^{|x|-1}x_i-\sum_{i=0}^{|y|-1}y_i=c\f$
+    static ExecStatus
+    post(Home home, ViewArray<View>& x, ViewArray<View>& y, Val c);
+  };
+
+  /**
+   * \brief %Propagator for incremental bounds consistent n-ary linear less or equal
+   *
+   * Requires \code #include <gecode/int/linear.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class Val, class View>
+  class IncLq : public IncLin<Val,View> {
+  protected:
+    using typename IncLin<Val,View>::Term;
+    using IncLin<Val,View>::x;
+    using IncLin<Val,View>::y;
+    using IncLin<Val,View>::c;
+    using IncLin<Val,View>::co;
+    using IncLin<Val,View>::sl;
+    using IncLin<Val,View>::su;
+    using IncLin<Val,View>::w;
+    /// Whether propagation can prune a bound or detect subsumption
+    bool prunable(void) const;
+    /// Constructor for cloning \a p
+    IncLq(Space& home, IncLq& p);
+  public:
+    /// Constructor for creation
+    IncLq(Home home, ViewArray<View>& x, ViewArray<View>& y, Val c);
+    /// Create copy during cloning
+    virtual Actor* copy(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for \f$\sum_{i=0}^{|x|-1}x_i-\sum_{i=0}^{|y|-1}y_i\leq c\f$
+    static ExecStatus
+    post(Home home, ViewArray<View>& x, ViewArray<View>& y, Val c);
+  };
+
 }}}
 
 #include <gecode/int/linear/int-nary.hpp>
 #include <gecode/int/linear/int-dom.hpp>
+#include <gecode/int/linear/int-inc.hpp>
 
 namespace Gecode { namespace Int { namespace Linear {
 
@@ -1322,6 +1461,121 @@ namespace Gecode { namespace Int { namespace Linear {
     static ExecStatus post(Home home, SBAP& p, SBAN& n, VX x, int c);
   };
 
+  /**
+   * \brief Base-class for incremental pseudo-Boolean propagators
+   *
+   * All terms are treated as literals with positive coefficients: a
+   * negative view \f$y\f$ with coefficient \f$a\f$ is the literal
+   * \f$\neg y\f$ with coefficient \f$a\f$. The slack of the constraint
+   * is maintained by advisors on the literals, and the literals are kept
+   * sorted in decreasing order of coefficients. The propagator is only
+   * scheduled if the slack drops below the largest coefficient of an
+   * unassigned literal, and then only inspects literals from the front
+   * of the arrays.
+   */
+  class IncBoolScale : public Propagator {
+  protected:
+    /// %Advisor for a single literal
+    class Literal : public ViewAdvisor<BoolView> {
+    public:
+      /// Coefficient
+      int a;
+      /// Whether the literal is the view itself (or its negation)
+      bool pos;
+      /// Create advisor for view \a x with coefficient \a a
+      Literal(Space& home, Propagator& p, Council<Literal>& c,
+              BoolView x, int a, bool pos);
+      /// Clone advisor \a l
+      Literal(Space& home, Literal& l);
+    };
+    /// Positive views (sorted by decreasing coefficients)
+    ScaleBoolArray p;
+    /// Negative views (sorted by decreasing coefficients)
+    ScaleBoolArray n;
+    /// The advisor council
+    Council<Literal> co;
+    /// Coefficients that can still become true without violating the constraint
+    long long int sl;
+    /// Coefficients that can still become false without violating equality
+    long long int su;
+    /// Return largest coefficient at the front of the arrays
+    int amax(void) const;
+    /**
+     * \brief Assign unassigned literals at the front of \a a
+     *
+     * Literals with a coefficient larger than \a sl become false and, if
+     * \a eq is true, literals with a coefficient larger than \a su become
+     * true. Sets \a mod to true if a literal has been assigned.
+     */
+    ExecStatus prune(Space& home, ScaleBoolArray& a, bool pos, bool eq,
+                     bool& mod);
+    /// Constructor for cloning \a pr
+    IncBoolScale(Space& home, IncBoolScale& pr);
+    /// Constructor for creation
+    IncBoolScale(Home home, ScaleBoolArray& p, ScaleBoolArray& n, int c);
+  public:
+    /// Cost function (defined as low linear)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+  };
+
+  /**
+   * \brief %Propagator for incremental pseudo-Boolean equality
+   *
+   * Requires \code #include <gecode/int/linear.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  class IncEqBoolScale : public IncBoolScale {
+  protected:
+    /// Whether propagation can assign a literal or detect subsumption
+    bool prunable(void) const;
+    /// Constructor for cloning \a pr
+    IncEqBoolScale(Space& home, IncEqBoolScale& pr);
+    /// Constructor for creation
+    IncEqBoolScale(Home home, ScaleBoolArray& p, ScaleBoolArray& n, int c);
+  public:
+    /// Create copy during cloning
+    virtual Actor* copy(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for \f$\sum_{i}a_ip_i-\sum_{i}a_in_i=c\f$
+    static ExecStatus post(Home home, ScaleBoolArray& p, ScaleBoolArray& n,
+                           int c);
+  };
+
+  /**
+   * \brief %Propagator for incremental pseudo-Boolean less or equal
+   *
+   * Requires \code #include <gecode/int/linear.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  class IncLqBoolScale : public IncBoolScale {
+  protected:
+    /// Whether propagation can assign a literal or detect subsumption
+    bool prunable(void) const;
+    /// Constructor for cloning \a pr
+    IncLqBoolScale(Space& home, IncLqBoolScale& pr);
+    /// Constructor for creation
+    IncLqBoolScale(Home home, ScaleBoolArray& p, ScaleBoolArray& n, int c);
+  public:
+    /// Create copy during cloning
+    virtual Actor* copy(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for \f$\sum_{i}a_ip_i-\sum_{i}a_in_i\leq c\f$
+    static ExecStatus post(Home home, ScaleBoolArray& p, ScaleBoolArray& n,
+                           int c);
+  };
+
 }}}
 
 #include <gecode/int/linear/bool-scale.hpp>
@@ -0,0 +1,252 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/int/linear.hh>
+
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Linear {
+
+  /*
+   * Advisors for literals
+   *
+   */
+  forceinline
+  IncBoolScale::Literal::Literal(Space& home, Propagator& p,
+                                 Council<Literal>& c, BoolView x,
+                                 int a0, bool pos0)
+    : ViewAdvisor<BoolView>(home,p,c,x), a(a0), pos(pos0) {}
+
+  forceinline
+  IncBoolScale::Literal::Literal(Space& home, Literal& l)
+    : ViewAdvisor<BoolView>(home,l), a(l.a), pos(l.pos) {}
+
+
+  /*
+   * Base-class for incremental pseudo-Boolean propagators
+   *
+   */
+  IncBoolScale::IncBoolScale(Home home, ScaleBoolArray& p0,
+                             ScaleBoolArray& n0, int c)
+    : Propagator(home), p(p0), n(n0), co(home), sl(c), su(0) {
+    p.sort(); n.sort();
+    /*
+     * A negative view y with coefficient a contributes a*(1-y)-a,
+     * so all terms are literals with positive coefficients.
+     */
+    for (ScaleBool* f=n.fst(); f<n.lst(); f++)
+      sl += f->a;
+    su = -sl;
+    for (ScaleBool* f=p.fst(); f<p.lst(); f++)
+      if (f->x.none()) {
+        su += f->a;
+        (void) new (home) Literal(home,*this,co,f->x,f->a,true);
+      } else if (f->x.one()) {
+        sl -= f->a; su += f->a;
+      }
+    for (ScaleBool* f=n.fst(); f<n.lst(); f++)
+      if (f->x.none()) {
+        su += f->a;
+        (void) new (home) Literal(home,*this,co,f->x,f->a,false);
+      } else if (f->x.zero()) {
+        sl -= f->a; su += f->a;
+      }
+    BoolView::schedule(home,*this,ME_BOOL_VAL);
+  }
+
+  IncBoolScale::IncBoolScale(Space& home, IncBoolScale& pr)
+    : Propagator(home,pr), sl(pr.sl), su(pr.su) {
+    p.update(home,pr.p);
+    n.update(home,pr.n);
+    co.update(home,pr.co);
+  }
+
+  int
+  IncBoolScale::amax(void) const {
+    int a = 0;
+    if (!p.empty())
+      a = p.fst()->a;
+    if (!n.empty())
+      a = std::max(a,n.fst()->a);
+    return a;
+  }
+
+  ExecStatus
+  IncBoolScale::prune(Space& home, ScaleBoolArray& a, bool pos, bool eq,
+                      bool& mod) {
+    long long int s = eq ? std::min(sl,su) : sl;
+    ScaleBool* f = a.fst();
+    for (ScaleBool* l = a.lst(); (f < l) && (!f->x.none() || (f->a > s)); f++)
+      if (f->x.none()) {
+        // The literal must be false if it exceeds the slack and true otherwise
+        if ((f->a > sl) == pos)
+          GECODE_ME_CHECK(f->x.zero_none(home));
+        else
+          GECODE_ME_CHECK(f->x.one_none(home));
+        mod = true;
+      }
+    a.fst(f);
+    return ES_OK;
+  }
+
+  PropCost
+  IncBoolScale::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::LO, p.size() + n.size());
+  }
+
+  size_t
+  IncBoolScale::dispose(Space& home) {
+    co.dispose(home);
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+
+  /*
+   * Incremental pseudo-Boolean equality
+   *
+   */
+  forceinline
+  IncEqBoolScale::IncEqBoolScale(Home home, ScaleBoolArray& p,
+                                 ScaleBoolArray& n, int c)
+    : IncBoolScale(home,p,n,c) {}
+
+  forceinline
+  IncEqBoolScale::IncEqBoolScale(Space& home, IncEqBoolScale& pr)
+    : IncBoolScale(home,pr) {}
+
+  Actor*
+  IncEqBoolScale::copy(Space& home) {
+    return new (home) IncEqBoolScale(home,*this);
+  }
+
+  forceinline bool
+  IncEqBoolScale::prunable(void) const {
+    long long int a = amax();
+    return (sl < a) || (su < a) || (sl < 0) || (su < 0);
+  }
+
+  ExecStatus
+  IncEqBoolScale::advise(Space& home, Advisor& a0, const Delta&) {
+    Literal& a(static_cast<Literal&>(a0));
+    if (a.view().one() == a.pos)
+      sl -= a.a;
+    else
+      su -= a.a;
+    return prunable() ? home.ES_NOFIX_DISPOSE(co,a) :
+      home.ES_FIX_DISPOSE(co,a);
+  }
+
+  void
+  IncEqBoolScale::reschedule(Space& home) {
+    if (prunable())
+      BoolView::schedule(home,*this,ME_BOOL_VAL);
+  }
+
+  ExecStatus
+  IncEqBoolScale::propagate(Space& home, const ModEventDelta&) {
+    bool mod;
+    do {
+      if ((sl < 0) || (su < 0))
+        return ES_FAILED;
+      mod = false;
+      GECODE_ES_CHECK(prune(home,p,true,true,mod));
+      GECODE_ES_CHECK(prune(home,n,false,true,mod));
+    } while (mod);
+    return (p.empty() && n.empty()) ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+  ExecStatus
+  IncEqBoolScale::post(Home home, ScaleBoolArray& p, ScaleBoolArray& n,
+                       int c) {
+    (void) new (home) IncEqBoolScale(home,p,n,c);
+    return ES_OK;
+  }
+
+
+  /*
+   * Incremental pseudo-Boolean inequality
+   *
+   */
+  forceinline
+  IncLqBoolScale::IncLqBoolScale(Home home, ScaleBoolArray& p,
+                                 ScaleBoolArray& n, int c)
+    : IncBoolScale(home,p,n,c) {}
+
+  forceinline
+  IncLqBoolScale::IncLqBoolScale(Space& home, IncLqBoolScale& pr)
+    : IncBoolScale(home,pr) {}
+
+  Actor*
+  IncLqBoolScale::copy(Space& home) {
+    return new (home) IncLqBoolScale(home,*this);
+  }
+
+  forceinline bool
+  IncLqBoolScale::prunable(void) const {
+    return (sl < amax()) || (su <= 0);
+  }
+
+  ExecStatus
+  IncLqBoolScale::advise(Space& home, Advisor& a0, const Delta&) {
+    Literal& a(static_cast<Literal&>(a0));
+    if (a.view().one() == a.pos)
+      sl -= a.a;
+    else
+      su -= a.a;
+    return prunable() ? home.ES_NOFIX_DISPOSE(co,a) :
+      home.ES_FIX_DISPOSE(co,a);
+  }
+
+  void
+  IncLqBoolScale::reschedule(Space& home) {
+    if (prunable())
+      BoolView::schedule(home,*this,ME_BOOL_VAL);
+  }
+
+  ExecStatus
+  IncLqBoolScale::propagate(Space& home, const ModEventDelta&) {
+    if (sl < 0)
+      return ES_FAILED;
+    // Setting literals to false does not change the slack
+    bool mod = false;
+    GECODE_ES_CHECK(prune(home,p,true,false,mod));
+    GECODE_ES_CHECK(prune(home,n,false,false,mod));
+    return ((su <= 0) || (p.empty() && n.empty())) ?
+      home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+  ExecStatus
+  IncLqBoolScale::post(Home home, ScaleBoolArray& p, ScaleBoolArray& n,
+                       int c) {
+    (void) new (home) IncLqBoolScale(home,p,n,c);
+    return ES_OK;
+  }
+
+}}}
+
+// STATISTICS: int-prop
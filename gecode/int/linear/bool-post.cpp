@@ -503,6 +503,22 @@ namespace Gecode { namespace Int { namespace Linear {
         f[i].x=t_n[i].x; f[i].a=t_n[i].a;
       }
     }
+    if (n_p + n_n >= inc_min_terms) {
+      // Large constraints are propagated incrementally
+      switch (irt) {
+      case IRT_EQ:
+        GECODE_ES_FAIL(IncEqBoolScale::post(home,b_p,b_n,c));
+        return;
+      case IRT_LQ:
+        GECODE_ES_FAIL(IncLqBoolScale::post(home,b_p,b_n,c));
+        return;
+      case IRT_GQ:
+        GECODE_ES_FAIL(IncLqBoolScale::post(home,b_n,b_p,-c));
+        return;
+      default:
+        break;
+      }
+    }
     switch (irt) {
     case IRT_EQ:
       GECODE_ES_FAIL(
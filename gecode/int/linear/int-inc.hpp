@@ -0,0 +1,298 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Linear {
+
+  /*
+   * Advisors for terms
+   *
+   */
+  template<class Val, class View>
+  forceinline
+  IncLin<Val,View>::Term::Term(Space& home, Propagator& p,
+                               Council<Term>& c, int i0, Val l0, Val u0)
+    : Advisor(home,p,c), i(i0), l(l0), u(u0) {}
+
+  template<class Val, class View>
+  forceinline
+  IncLin<Val,View>::Term::Term(Space& home, Term& a)
+    : Advisor(home,a), i(a.i), l(a.l), u(a.u) {}
+
+
+  /*
+   * Base-class for incremental linear propagators
+   *
+   */
+  template<class Val, class View>
+  forceinline
+  IncLin<Val,View>::IncLin(Home home, ViewArray<View>& x0,
+                           ViewArray<View>& y0, Val c0)
+    : Propagator(home), x(x0), y(y0), c(c0), co(home), sl(0), su(0), w(0) {
+    for (int i=0; i<x.size(); i++) {
+      Val l = x[i].min(), u = x[i].max();
+      sl += l; su += u; w = std::max(w,u-l);
+      if (!x[i].assigned())
+        x[i].subscribe(home,*new (home) Term(home,*this,co,i,l,u));
+    }
+    for (int i=0; i<y.size(); i++) {
+      Val l = -y[i].max(), u = -y[i].min();
+      sl += l; su += u; w = std::max(w,u-l);
+      if (!y[i].assigned())
+        y[i].subscribe(home,*new (home) Term(home,*this,co,-i-1,l,u));
+    }
+    View::schedule(home,*this,ME_INT_BND);
+  }
+
+  template<class Val, class View>
+  forceinline
+  IncLin<Val,View>::IncLin(Space& home, IncLin<Val,View>& p)
+    : Propagator(home,p), c(p.c), sl(p.sl), su(p.su), w(p.w) {
+    x.update(home,p.x);
+    y.update(home,p.y);
+    co.update(home,p.co);
+  }
+
+  template<class Val, class View>
+  forceinline bool
+  IncLin<Val,View>::update(Term& a) {
+    Val l, u;
+    if (a.i >= 0) {
+      l = x[a.i].min(); u = x[a.i].max();
+    } else {
+      l = -y[-a.i-1].max(); u = -y[-a.i-1].min();
+    }
+    sl += l - a.l; su += u - a.u;
+    a.l = l; a.u = u;
+    return l == u;
+  }
+
+  template<class Val, class View>
+  forceinline ExecStatus
+  IncLin<Val,View>::prune_max(Space& home) {
+    // The minimal values of the terms do not change
+    Val s = c - sl;
+    Val v = 0;
+    for (int i=0; i<x.size(); i++) {
+      GECODE_ME_CHECK(x[i].lq(home,s + x[i].min()));
+      v = std::max(v,static_cast<Val>(x[i].max()) - x[i].min());
+    }
+    for (int i=0; i<y.size(); i++) {
+      GECODE_ME_CHECK(y[i].gq(home,y[i].max() - s));
+      v = std::max(v,static_cast<Val>(y[i].max()) - y[i].min());
+    }
+    w = v;
+    return ES_OK;
+  }
+
+  template<class Val, class View>
+  forceinline ExecStatus
+  IncLin<Val,View>::prune_min(Space& home) {
+    // The maximal values of the terms do not change
+    Val s = su - c;
+    Val v = 0;
+    for (int i=0; i<x.size(); i++) {
+      GECODE_ME_CHECK(x[i].gq(home,x[i].max() - s));
+      v = std::max(v,static_cast<Val>(x[i].max()) - x[i].min());
+    }
+    for (int i=0; i<y.size(); i++) {
+      GECODE_ME_CHECK(y[i].lq(home,s + y[i].min()));
+      v = std::max(v,static_cast<Val>(y[i].max()) - y[i].min());
+    }
+    w = v;
+    return ES_OK;
+  }
+
+  template<class Val, class View>
+  PropCost
+  IncLin<Val,View>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::LO, x.size()+y.size());
+  }
+
+  template<class Val, class View>
+  forceinline size_t
+  IncLin<Val,View>::dispose(Space& home) {
+    // Cancel remaining advisors
+    for (Advisors<Term> as(co); as(); ++as) {
+      int i = as.advisor().i;
+      if (i >= 0)
+        x[i].cancel(home,as.advisor());
+      else
+        y[-i-1].cancel(home,as.advisor());
+    }
+    co.dispose(home);
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+
+  /*
+   * Incremental bounds consistent linear equation
+   *
+   */
+
+  template<class Val, class View>
+  forceinline
+  IncEq<Val,View>::IncEq(Home home, ViewArray<View>& x, ViewArray<View>& y,
+                         Val c)
+    : IncLin<Val,View>(home,x,y,c) {}
+
+  template<class Val, class View>
+  ExecStatus
+  IncEq<Val,View>::post(Home home, ViewArray<View>& x, ViewArray<View>& y,
+                        Val c) {
+    (void) new (home) IncEq<Val,View>(home,x,y,c);
+    return ES_OK;
+  }
+
+  template<class Val, class View>
+  forceinline
+  IncEq<Val,View>::IncEq(Space& home, IncEq<Val,View>& p)
+    : IncLin<Val,View>(home,p) {}
+
+  template<class Val, class View>
+  Actor*
+  IncEq<Val,View>::copy(Space& home) {
+    return new (home) IncEq<Val,View>(home,*this);
+  }
+
+  template<class Val, class View>
+  forceinline bool
+  IncEq<Val,View>::prunable(void) const {
+    return (w > c - sl) || (w > su - c) || (sl == su);
+  }
+
+  template<class Val, class View>
+  ExecStatus
+  IncEq<Val,View>::advise(Space& home, Advisor& a0, const Delta&) {
+    Term& a(static_cast<Term&>(a0));
+    if (this->update(a))
+      return prunable() ? home.ES_NOFIX_DISPOSE(co,a) :
+        home.ES_FIX_DISPOSE(co,a);
+    return prunable() ? ES_NOFIX : ES_FIX;
+  }
+
+  template<class Val, class View>
+  void
+  IncEq<Val,View>::reschedule(Space& home) {
+    if (prunable())
+      View::schedule(home,*this,ME_INT_BND);
+  }
+
+  template<class Val, class View>
+  ExecStatus
+  IncEq<Val,View>::propagate(Space& home, const ModEventDelta&) {
+    bool mod;
+    do {
+      if ((sl > c) || (su < c))
+        return ES_FAILED;
+      mod = false;
+      if (w > c - sl) {
+        Val u = su;
+        GECODE_ES_CHECK(this->prune_max(home));
+        mod = (u != su);
+      }
+      if (su < c)
+        return ES_FAILED;
+      if (w > su - c) {
+        Val l = sl;
+        GECODE_ES_CHECK(this->prune_min(home));
+        mod = mod || (l != sl);
+      }
+    } while (mod);
+    return (sl == su) ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+
+  /*
+   * Incremental bounds consistent linear inequation
+   *
+   */
+
+  template<class Val, class View>
+  forceinline
+  IncLq<Val,View>::IncLq(Home home, ViewArray<View>& x, ViewArray<View>& y,
+                         Val c)
+    : IncLin<Val,View>(home,x,y,c) {}
+
+  template<class Val, class View>
+  ExecStatus
+  IncLq<Val,View>::post(Home home, ViewArray<View>& x, ViewArray<View>& y,
+                        Val c) {
+    (void) new (home) IncLq<Val,View>(home,x,y,c);
+    return ES_OK;
+  }
+
+  template<class Val, class View>
+  forceinline
+  IncLq<Val,View>::IncLq(Space& home, IncLq<Val,View>& p)
+    : IncLin<Val,View>(home,p) {}
+
+  template<class Val, class View>
+  Actor*
+  IncLq<Val,View>::copy(Space& home) {
+    return new (home) IncLq<Val,View>(home,*this);
+  }
+
+  template<class Val, class View>
+  forceinline bool
+  IncLq<Val,View>::prunable(void) const {
+    return (w > c - sl) || (su <= c);
+  }
+
+  template<class Val, class View>
+  ExecStatus
+  IncLq<Val,View>::advise(Space& home, Advisor& a0, const Delta&) {
+    Term& a(static_cast<Term&>(a0));
+    if (this->update(a))
+      return prunable() ? home.ES_NOFIX_DISPOSE(co,a) :
+        home.ES_FIX_DISPOSE(co,a);
+    return prunable() ? ES_NOFIX : ES_FIX;
+  }
+
+  template<class Val, class View>
+  void
+  IncLq<Val,View>::reschedule(Space& home) {
+    if (prunable())
+      View::schedule(home,*this,ME_INT_BND);
+  }
+
+  template<class Val, class View>
+  ExecStatus
+  IncLq<Val,View>::propagate(Space& home, const ModEventDelta&) {
+    if (sl > c)
+      return ES_FAILED;
+    // Pruning upper bounds does not change the minimal values
+    if (w > c - sl)
+      GECODE_ES_CHECK(this->prune_max(home));
+    return (su <= c) ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+}}}
+
+// STATISTICS: int-prop
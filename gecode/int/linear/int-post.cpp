@@ -157,15 +157,23 @@ namespace Gecode { namespace Int { namespace Linear {
   forceinline void
   post_nary(Home home,
             ViewArray<View>& x, ViewArray<View>& y, IntRelType irt, Val c) {
+    // Large constraints are propagated incrementally
+    bool inc = (x.size() + y.size() >= inc_min_terms);
     switch (irt) {
     case IRT_EQ:
-      GECODE_ES_FAIL((Eq<Val,View,View >::post(home,x,y,c)));
+      if (inc)
+        GECODE_ES_FAIL((IncEq<Val,View>::post(home,x,y,c)));
+      else
+        GECODE_ES_FAIL((Eq<Val,View,View >::post(home,x,y,c)));
       break;
     case IRT_NQ:
       GECODE_ES_FAIL((Nq<Val,View,View >::post(home,x,y,c)));
       break;
     case IRT_LQ:
-      GECODE_ES_FAIL((Lq<Val,View,View >::post(home,x,y,c)));
+      if (inc)
+        GECODE_ES_FAIL((IncLq<Val,View>::post(home,x,y,c)));
+      else
+        GECODE_ES_FAIL((Lq<Val,View,View >::post(home,x,y,c)));
       break;
     default: GECODE_NEVER;
     }
@@ -45,6 +45,16 @@ namespace Gecode {
       return false;
     }
 
+    /// Post propagator for \a n mandatory boxes \a b
+    template<class Box>
+    ExecStatus
+    manpost(Home home, Box* b, int n) {
+      if (n >= sweep_min_boxes)
+        return SweepProp<Box>::post(home,b,n);
+      else
+        return ManProp<Box>::post(home,b,n);
+    }
+
   }}
 
   void
@@ -74,8 +84,7 @@ namespace Gecode {
       b[i][1] = FixDim(y[i],h[i]);
     }
 
-    GECODE_ES_FAIL((
-      NoOverlap::ManProp<ManBox<FixDim,2> >::post(home,b,x.size())));
+    GECODE_ES_FAIL(NoOverlap::manpost(home,b,x.size()));
   }
 
   void
@@ -119,7 +128,7 @@ namespace Gecode {
           b[n][1] = FixDim(y[i],h[i]);
           n++;
         }
-      GECODE_ES_FAIL((NoOverlap::ManProp<ManBox<FixDim,2> >::post(home,b,n)));
+      GECODE_ES_FAIL(NoOverlap::manpost(home,b,n));
     }
   }
 
@@ -155,8 +164,7 @@ namespace Gecode {
         b[i][0] = FlexDim(x0[i],w[i],x1[i]);
         b[i][1] = FlexDim(y0[i],h[i],y1[i]);
       }
-      GECODE_ES_FAIL((
-        NoOverlap::ManProp<ManBox<FlexDim,2> >::post(home,b,x0.size())));
+      GECODE_ES_FAIL(NoOverlap::manpost(home,b,x0.size()));
     }
   }
 
@@ -206,7 +214,7 @@ namespace Gecode {
           b[n][1] = FlexDim(y0[i],h[i],y1[i]);
           n++;
         }
-      GECODE_ES_FAIL((NoOverlap::ManProp<ManBox<FlexDim,2> >::post(home,b,n)));
+      GECODE_ES_FAIL(NoOverlap::manpost(home,b,n));
     }
   }
 
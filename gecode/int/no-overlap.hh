@@ -283,6 +283,40 @@ namespace Gecode { namespace Int { namespace NoOverlap {
     virtual size_t dispose(Space& home);
   };
 
+  /**
+   * \brief Sweep-based no-overlap propagator for mandatory boxes
+   *
+   * Keeps the boxes sorted by their smallest start coordinate in the
+   * first dimension and sweeps over them, so that only pairs of boxes
+   * that might overlap in the first dimension are considered.
+   *
+   * Requires \code #include <gecode/int/no-overlap.hh> \endcode
+   *
+   * \ingroup FuncIntProp
+   */
+  template<class Box>
+  class SweepProp : public Base<Box> {
+  protected:
+    using Base<Box>::b;
+    using Base<Box>::n;
+    /// Constructor for posting
+    SweepProp(Home home, Box* b, int n);
+    /// Constructor for cloning \a p
+    SweepProp(Space& home, SweepProp<Box>& p);
+  public:
+    /// Post propagator for boxes \a b
+    static ExecStatus post(Home home, Box* b, int n);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Copy propagator during cloning
+    virtual Actor* copy(Space& home);
+    /// Destructor
+    virtual size_t dispose(Space& home);
+  };
+
+  /// Minimal number of mandatory boxes for which sweeping is used
+  const int sweep_min_boxes = 64;
+
   /**
    * \brief No-overlap propagator for optional boxes
    *
@@ -316,6 +350,7 @@ namespace Gecode { namespace Int { namespace NoOverlap {
 
 #include <gecode/int/no-overlap/base.hpp>
 #include <gecode/int/no-overlap/man.hpp>
+#include <gecode/int/no-overlap/sweep.hpp>
 #include <gecode/int/no-overlap/opt.hpp>
 
 #endif
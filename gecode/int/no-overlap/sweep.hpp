@@ -0,0 +1,140 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Int { namespace NoOverlap {
+
+  template<class Box>
+  forceinline
+  SweepProp<Box>::SweepProp(Home home, Box* b, int n)
+    : Base<Box>(home, b, n) {}
+
+  template<class Box>
+  inline ExecStatus
+  SweepProp<Box>::post(Home home, Box* b, int n) {
+    if (n > 1)
+      (void) new (home) SweepProp<Box>(home,b,n);
+    return ES_OK;
+  }
+
+  template<class Box>
+  forceinline size_t
+  SweepProp<Box>::dispose(Space& home) {
+    (void) Base<Box>::dispose(home);
+    return sizeof(*this);
+  }
+
+
+  template<class Box>
+  forceinline
+  SweepProp<Box>::SweepProp(Space& home, SweepProp<Box>& p)
+    : Base<Box>(home, p, p.n) {}
+
+  template<class Box>
+  Actor*
+  SweepProp<Box>::copy(Space& home) {
+    return new (home) SweepProp<Box>(home,*this);
+  }
+
+  template<class Box>
+  ExecStatus
+  SweepProp<Box>::propagate(Space& home, const ModEventDelta&) {
+    /*
+     * Sort boxes by smallest start coordinate in the first dimension.
+     * As the boxes are kept in this order between executions, they
+     * are almost sorted and insertion sort is close to linear.
+     */
+    for (int i=1; i<n; i++) {
+      int s = b[i][0].ssc();
+      if (b[i-1][0].ssc() > s) {
+        Box t = b[i];
+        int j = i;
+        do {
+          b[j] = b[j-1]; j--;
+        } while ((j > 0) && (b[j-1][0].ssc() > s));
+        b[j] = t;
+      }
+    }
+
+    Region r;
+
+    // Coordinates in the first dimension when the sweep starts
+    int* ssc = r.alloc<int>(n);
+    int* lec = r.alloc<int>(n);
+    for (int i=0; i<n; i++) {
+      ssc[i] = b[i][0].ssc(); lec[i] = b[i][0].lec();
+    }
+
+    // Number of boxes that might overlap
+    int* ob = r.alloc<int>(n);
+    for (int i=0; i<n; i++)
+      ob[i] = 0;
+
+    // Boxes the sweep line has not yet passed in the first dimension
+    int* a = r.alloc<int>(n);
+    int na = 0;
+
+    for (int i=0; i<n; i++) {
+      int k = 0;
+      for (int l=0; l<na; l++) {
+        int j = a[l];
+        // Box j ends before box i starts in the first dimension
+        if (lec[j] <= ssc[i])
+          continue;
+        a[k++] = j;
+        if (!b[i].nooverlap(b[j])) {
+          ob[i]++; ob[j]++;
+          GECODE_ES_CHECK(b[i].nooverlap(home,b[j]));
+        }
+      }
+      na = k;
+      a[na++] = i;
+    }
+
+    // Eliminate boxes that do not overlap
+    int e = 0;
+    for (int i=0; i<n; i++)
+      if (ob[i] == 0)
+        e++;
+
+    if (e == n)
+      return home.ES_SUBSUMED(*this);
+
+    for (int i=n; i--; )
+      if (ob[i] == 0) {
+        b[i].cancel(home, *this);
+        b[i] = b[--n];
+      }
+
+    if (n < 2)
+      return home.ES_SUBSUMED(*this);
+
+    return ES_NOFIX;
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -199,6 +199,78 @@ namespace Gecode { namespace Int {
     /// Size of holes in the domain
     unsigned int holes;
 
+    /**
+     * \brief Bitset of values for domains of small width
+     *
+     * Value-based domain updates on domains of width at most
+     * \a bits first compute the new domain word-wise on a bitset
+     * and only then update the range list (if at all).
+     */
+    class SmallDom {
+    public:
+      /// Word of a bitset
+      class Word : public Support::BitSetData {
+      public:
+        /// Set bits \a l to \a h (inclusive)
+        void fill(unsigned int l, unsigned int h);
+        /// Return position greater or equal \a i of next cleared bit (or \a bpb)
+        unsigned int next0(unsigned int i) const;
+      };
+      /// Maximal width of a domain
+      static const unsigned int bits = 256U;
+      /// Number of words
+      static const unsigned int n_words = bits / Support::BitSetData::bpb;
+      /// Smallest value
+      int o;
+      /// Width
+      unsigned int w;
+      /// The words
+      Word d[n_words];
+      /// Initialize as empty for values from \a o to \a o + \a w - 1
+      SmallDom(int o, unsigned int w);
+      /// Add all values of domain of \a x
+      void add(const IntVarImp& x);
+      /// Add value \a v
+      void set(int v);
+      /// Remove value \a v
+      void clear(int v);
+      /// Intersect with \a s
+      void inter(const SmallDom& s);
+      /// Return number of values
+      unsigned int size(void) const;
+      /// Return position greater or equal \a i of next value (or \a w)
+      unsigned int next1(unsigned int i) const;
+      /// Return position greater or equal \a i of next non-value (or \a w)
+      unsigned int next0(unsigned int i) const;
+    };
+    /// Range iterator for values of small domain bitset
+    class SmallDomRanges {
+    protected:
+      /// The bitset
+      const SmallDom& s;
+      /// Position of minimum of current range
+      unsigned int l;
+      /// Position of maximum of current range
+      unsigned int h;
+      /// Find range starting at position greater or equal \a i
+      void find(unsigned int i);
+    public:
+      /// Initialize with bitset \a s
+      SmallDomRanges(const SmallDom& s);
+      /// Test whether iterator is still at a range or done
+      bool operator ()(void) const;
+      /// Move iterator to next range (if possible)
+      void operator ++(void);
+      /// Return smallest value of range
+      int min(void) const;
+      /// Return largest value of range
+      int max(void) const;
+      /// Return width of range (distance between minimum and maximum)
+      unsigned int width(void) const;
+    };
+    /// Replace domain by subset \a s of the domain
+    ModEvent narrow_s(Space& home, const SmallDom& s);
+
   protected:
     /// Constructor for cloning \a x
     IntVarImp(Space& home, IntVarImp& x);
@@ -494,6 +494,129 @@ namespace Gecode { namespace Int {
   }
 
 
+  /*
+   * Bitsets for domains of small width
+   *
+   */
+
+  forceinline void
+  IntVarImp::SmallDom::Word::fill(unsigned int l, unsigned int h) {
+    assert(l <= h && h < bpb);
+    bits |= (~static_cast<Base>(0U) >> (bpb - 1U - (h - l))) << l;
+  }
+  forceinline unsigned int
+  IntVarImp::SmallDom::Word::next0(unsigned int i) const {
+    assert(i < bpb);
+    Word c; c.bits = ~bits;
+    return c(i) ? c.next(i) : bpb;
+  }
+
+  forceinline
+  IntVarImp::SmallDom::SmallDom(int o0, unsigned int w0)
+    : o(o0), w(w0) {
+    assert(w <= bits);
+    for (unsigned int i=0U; i<n_words; i++)
+      d[i].init(false);
+  }
+  forceinline void
+  IntVarImp::SmallDom::add(const IntVarImp& x) {
+    const unsigned int bpb = Support::BitSetData::bpb;
+    for (IntVarImpFwd r(&x); r(); ++r) {
+      unsigned int l = static_cast<unsigned int>(r.min() - o);
+      unsigned int h = static_cast<unsigned int>(r.max() - o);
+      assert(h < w);
+      unsigned int lw = l / bpb, hw = h / bpb;
+      if (lw == hw) {
+        d[lw].fill(l % bpb, h % bpb);
+      } else {
+        d[lw].fill(l % bpb, bpb - 1U);
+        for (unsigned int i=lw+1U; i<hw; i++)
+          d[i].init(true);
+        d[hw].fill(0U, h % bpb);
+      }
+    }
+  }
+  forceinline void
+  IntVarImp::SmallDom::set(int v) {
+    unsigned int p = static_cast<unsigned int>(v - o);
+    assert(p < w);
+    d[p / Support::BitSetData::bpb].set(p % Support::BitSetData::bpb);
+  }
+  forceinline void
+  IntVarImp::SmallDom::clear(int v) {
+    unsigned int p = static_cast<unsigned int>(v - o);
+    assert(p < w);
+    d[p / Support::BitSetData::bpb].clear(p % Support::BitSetData::bpb);
+  }
+  forceinline void
+  IntVarImp::SmallDom::inter(const SmallDom& s) {
+    assert((o == s.o) && (w == s.w));
+    for (unsigned int i=0U; i<n_words; i++)
+      d[i].a(s.d[i]);
+  }
+  forceinline unsigned int
+  IntVarImp::SmallDom::size(void) const {
+    unsigned int n = 0U;
+    for (unsigned int i=0U; i<n_words; i++)
+      n += d[i].ones();
+    return n;
+  }
+  forceinline unsigned int
+  IntVarImp::SmallDom::next1(unsigned int i) const {
+    const unsigned int bpb = Support::BitSetData::bpb;
+    if (i >= w)
+      return w;
+    unsigned int j = i / bpb;
+    if (d[j](i % bpb))
+      return j * bpb + d[j].next(i % bpb);
+    while (++j < n_words)
+      if (d[j]())
+        return j * bpb + d[j].next(0U);
+    return w;
+  }
+  forceinline unsigned int
+  IntVarImp::SmallDom::next0(unsigned int i) const {
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int j = i / bpb;
+    unsigned int p = j * bpb + d[j].next0(i % bpb);
+    while ((p == (j + 1U) * bpb) && (++j < n_words))
+      p = j * bpb + d[j].next0(0U);
+    return std::min(p,w);
+  }
+
+  forceinline void
+  IntVarImp::SmallDomRanges::find(unsigned int i) {
+    l = s.next1(i);
+    if (l < s.w)
+      h = s.next0(l) - 1U;
+  }
+  forceinline
+  IntVarImp::SmallDomRanges::SmallDomRanges(const SmallDom& s0)
+    : s(s0) {
+    find(0U);
+  }
+  forceinline bool
+  IntVarImp::SmallDomRanges::operator ()(void) const {
+    return l < s.w;
+  }
+  forceinline void
+  IntVarImp::SmallDomRanges::operator ++(void) {
+    find(h + 1U);
+  }
+  forceinline int
+  IntVarImp::SmallDomRanges::min(void) const {
+    return s.o + static_cast<int>(l);
+  }
+  forceinline int
+  IntVarImp::SmallDomRanges::max(void) const {
+    return s.o + static_cast<int>(h);
+  }
+  forceinline unsigned int
+  IntVarImp::SmallDomRanges::width(void) const {
+    return h - l + 1U;
+  }
+
+
   /*
    * Iterator-based domain operations
    *
@@ -665,6 +788,18 @@ namespace Gecode { namespace Int {
     return notify(home,me,d);
   }
 
+  forceinline ModEvent
+  IntVarImp::narrow_s(Space& home, const SmallDom& s) {
+    unsigned int n = s.size();
+    if (n == 0U)
+      return fail(home);
+    if (n == size())
+      return ME_INT_NONE;
+    // The new domain is a subset: the range list can be updated in place
+    SmallDomRanges r(s);
+    return narrow_r(home,r,false);
+  }
+
   template<class I>
   forceinline ModEvent
   IntVarImp::inter_r(Space& home, I& i, bool) {
@@ -840,6 +975,19 @@ namespace Gecode { namespace Int {
   template<class I>
   forceinline ModEvent
   IntVarImp::inter_v(Space& home, I& i, bool depends) {
+    if (width() <= SmallDom::bits) {
+      // The iterator is consumed before the domain is updated
+      SmallDom v(dom.min(),width());
+      while (i() && (i.val() < dom.min()))
+        ++i;
+      while (i() && (i.val() <= dom.max())) {
+        v.set(i.val()); ++i;
+      }
+      SmallDom s(dom.min(),width());
+      s.add(*this);
+      s.inter(v);
+      return narrow_s(home,s);
+    }
     Iter::Values::ToRanges<I> r(i);
     return inter_r(home,r,depends);
   }
@@ -870,6 +1018,16 @@ namespace Gecode { namespace Int {
     if (!i() || (i.val() > dom.max()))
       return nq_full(home,v);
 
+    if (width() <= SmallDom::bits) {
+      SmallDom s(dom.min(),width());
+      s.add(*this);
+      s.clear(v);
+      while (i() && (i.val() <= dom.max())) {
+        s.clear(i.val()); ++i;
+      }
+      return narrow_s(home,s);
+    }
+
     // Set up two sentinel elements
     RangeList f, l;
     // Put all ranges between sentinels
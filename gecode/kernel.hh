@@ -130,6 +130,7 @@ namespace Gecode {
 #include <gecode/kernel/memory/config.hpp>
 #include <gecode/kernel/memory/manager.hpp>
 #include <gecode/kernel/memory/region.hpp>
+#include <gecode/kernel/memory/footprint.hpp>
 
 /*
  * Macros for checking failure
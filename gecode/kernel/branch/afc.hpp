@@ -94,6 +94,14 @@ namespace Gecode {
     /// Return decay factor
     double decay(const Space& home) const;
     //@}
+
+    /// \name Merging of failures
+    //@{
+    /// %Set after how many failures AFC information is merged to \a n
+    void merge(Space& home, unsigned int n);
+    /// Return after how many failures AFC information is merged
+    unsigned int merge(const Space& home) const;
+    //@}
   };
 
   /**
@@ -168,6 +176,16 @@ namespace Gecode {
     return home.afc_decay();
   }
 
+  forceinline void
+  AFC::merge(Space& home, unsigned int n) {
+    home.afc_merge(n);
+  }
+
+  forceinline unsigned int
+  AFC::merge(const Space& home) const {
+    return home.afc_merge();
+  }
+
 
   template<class Char, class Traits>
   std::basic_ostream<Char,Traits>&
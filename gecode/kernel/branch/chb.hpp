@@ -164,6 +164,18 @@ namespace Gecode {
     CHB chb;
     /// The advisor council
     Council<Idx> c;
+    /// Indices of views with updates not yet merged into chb information
+    int* pu;
+    /// Number of updates not yet merged
+    int n_pu;
+    /// Capacity of \a pu
+    int c_pu;
+    /// Number of propagations since last merge
+    unsigned int n_p;
+    /// Record update without failure for view \a i
+    void pending(Space& home, int i);
+    /// Merge updates not yet merged (requires chb information to be locked)
+    void merge(void);
     /// Constructor for cloning \a p
     Recorder(Space& home, Recorder<View>& p);
   public:
@@ -242,7 +254,8 @@ namespace Gecode {
   forceinline
   CHB::Recorder<View>::Recorder(Home home, ViewArray<View>& x,
                                 CHB& chb0)
-    : NaryPropagator<View,PC_GEN_NONE>(home,x), chb(chb0), c(home) {
+    : NaryPropagator<View,PC_GEN_NONE>(home,x), chb(chb0), c(home),
+      pu(nullptr), n_pu(0), c_pu(0), n_p(0U) {
     home.notice(*this,AP_DISPOSE);
     for (int i=0; i<x.size(); i++)
       if (!x[i].assigned())
@@ -386,10 +399,31 @@ namespace Gecode {
   template<class View>
   forceinline
   CHB::Recorder<View>::Recorder(Space& home, Recorder<View>& p)
-    : NaryPropagator<View,PC_GEN_NONE>(home,p), chb(p.chb) {
+    : NaryPropagator<View,PC_GEN_NONE>(home,p), chb(p.chb),
+      pu(nullptr), n_pu(0), c_pu(0), n_p(0U) {
+    // Updates not yet merged stay with the original
     c.update(home, p.c);
   }
 
+  template<class View>
+  forceinline void
+  CHB::Recorder<View>::pending(Space& home, int i) {
+    if (n_pu == c_pu) {
+      int n = std::max(2*c_pu,x.size());
+      pu = home.realloc<int>(pu,c_pu,n);
+      c_pu = n;
+    }
+    pu[n_pu++] = i;
+  }
+
+  template<class View>
+  forceinline void
+  CHB::Recorder<View>::merge(void) {
+    for (int j=0; j<n_pu; j++)
+      chb.update(pu[j],false);
+    n_pu = 0; n_p = 0U;
+  }
+
   template<class View>
   Propagator*
   CHB::Recorder<View>::copy(Space& home) {
@@ -401,6 +435,12 @@ namespace Gecode {
   CHB::Recorder<View>::dispose(Space& home) {
     // Delete access to chb information
     home.ignore(*this,AP_DISPOSE);
+    if (n_pu > 0) {
+      chb.acquire();
+      merge();
+      chb.release();
+    }
+    home.free<int>(pu,c_pu);
     chb.~CHB();
     // Cancel remaining advisors
     for (Advisors<Idx> as(c); as(); ++as)
@@ -438,8 +478,28 @@ namespace Gecode {
   template<class View>
   ExecStatus
   CHB::Recorder<View>::propagate(Space& home, const ModEventDelta&) {
+    unsigned int k = home.afc_merge();
+    if (!home.failed() && (k > 1U)) {
+      // Record updates locally, merge only every k propagations
+      for (Advisors<Idx> as(c); as(); ++as) {
+        int i = as.advisor().idx();
+        if (as.advisor().marked()) {
+          as.advisor().unmark();
+          pending(home,i);
+          if (x[i].assigned())
+            as.advisor().dispose(home,c);
+        }
+      }
+      if (++n_p >= k) {
+        chb.acquire();
+        merge();
+        chb.release();
+      }
+      return c.empty() ? home.ES_SUBSUMED(*this) : ES_FIX;
+    }
     // Lock chb information
     chb.acquire();
+    merge();
     if (home.failed()) {
       chb.bump();
       for (Advisors<Idx> as(c); as(); ++as) {
@@ -2691,10 +2691,39 @@ namespace Gecode {
     void afc_decay(double d);
     /// Return AFC decay factor
     double afc_decay(void) const;
+    /**
+     * \brief %Set after how many failures AFC and CHB information is merged
+     *
+     * With \a n greater than one, failures are first accumulated per
+     * thread (for AFC) or per space (for CHB) and only merged into the
+     * information shared by all clones after \a n failures or
+     * propagations. This reduces contention for parallel search.
+     */
+    void afc_merge(unsigned int n);
+    /// Return after how many failures AFC and CHB information is merged
+    unsigned int afc_merge(void) const;
     /// Unshare AFC information for all propagators
     GECODE_KERNEL_EXPORT void afc_unshare(void);
     //@}
 
+    /**
+     * \brief Add the memory footprint of the space to \a mf
+     *
+     * The kernel accounts for the space heap, the subscriptions, and
+     * the size (as returned by Actor::dispose) of all propagators and
+     * branchers. Spaces can refine this function to also account for
+     * their variables and shared objects.
+     *
+     * Actors are measured on a clone of the space. Hence, the space
+     * must be stable and an exception of type SpaceNotStable is thrown
+     * otherwise. For a failed space, only heap and subscriptions are
+     * accounted for.
+     *
+     * \ingroup FuncMemSpace
+     */
+    GECODE_KERNEL_EXPORT
+    virtual void footprint(MemoryFootprint& mf);
+
   protected:
     /**
      * \brief Class to iterate over propagators of a space
@@ -3308,6 +3337,16 @@ namespace Gecode {
     ssd.data().gpi.decay(d);
   }
 
+  forceinline unsigned int
+  Space::afc_merge(void) const {
+    return ssd.data().gpi.merge();
+  }
+
+  forceinline void
+  Space::afc_merge(unsigned int n) {
+    ssd.data().gpi.merge(n);
+  }
+
   forceinline size_t
   Actor::dispose(Space&) {
     return sizeof(*this);
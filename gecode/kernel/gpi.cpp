@@ -37,6 +37,36 @@ namespace Gecode { namespace Kernel {
 
   Support::Mutex GPI::m;
 
+  std::atomic<unsigned long long int> GPI::ids(0ULL);
+
+  void
+  GPI::buffer(Info& c, unsigned int k) {
+    // Identifier of the GPI object the cached buffer belongs to
+    thread_local unsigned long long int cid = 0ULL;
+    // Cached buffer of this thread
+    thread_local Buffer* cb = nullptr;
+    // Its address identifies the thread
+    thread_local char self;
+    if (cid != id) {
+      m.acquire();
+      Buffer* f = bs;
+      while ((f != nullptr) && (f->owner != &self))
+        f = f->next;
+      if (f == nullptr)
+        bs = f = new Buffer(&self,bs);
+      m.release();
+      cid = id; cb = f;
+    }
+    cb->info[cb->n++] = &c;
+    if (cb->n >= k) {
+      m.acquire();
+      for (unsigned int i=0U; i<cb->n; i++)
+        count(*cb->info[i]);
+      m.release();
+      cb->n = 0U;
+    }
+  }
+
 }}
 
 // STATISTICS: kernel-prop
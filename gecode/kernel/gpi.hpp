@@ -32,6 +32,7 @@
  */
 
 #include <cmath>
+#include <algorithm>
 
 namespace Gecode { namespace Kernel {
 
@@ -67,6 +68,22 @@ namespace Gecode { namespace Kernel {
       /// Rescale used afc values in entries
       void rescale(void);
     };
+    /// Per-thread buffer of failures not yet merged into the afc values
+    class Buffer : public HeapAllocated {
+    public:
+      /// Maximal number of failures in a buffer
+      static const unsigned int n_info = 256;
+      /// Identifies the thread owning the buffer
+      const void* owner;
+      /// Number of buffered failures
+      unsigned int n;
+      /// Propagator information for buffered failures
+      Info* info[n_info];
+      /// Next buffer
+      Buffer* next;
+      /// Initialize for thread identified by \a o
+      Buffer(const void* o, Buffer* n);
+    };
     /// The current block
     Block* b;
     /// The inverse decay factor
@@ -75,10 +92,22 @@ namespace Gecode { namespace Kernel {
     std::atomic<unsigned int> npid;
     /// Whether to unshare
     bool us;
+    /// After how many failures the failures of a thread are merged
+    std::atomic<unsigned int> mc;
+    /// Buffers of all threads that have recorded failures
+    Buffer* bs;
+    /// Unique identifier (used by threads to find their buffer)
+    unsigned long long int id;
     /// The first block
     Block fst;
     /// Mutex to synchronize globally shared access
     GECODE_KERNEL_EXPORT static Support::Mutex m;
+    /// Last used identifier
+    GECODE_KERNEL_EXPORT static std::atomic<unsigned long long int> ids;
+    /// Increment failure count of \a c (requires the mutex to be held)
+    void count(Info& c);
+    /// Record failure of \a c in the buffer of the calling thread
+    GECODE_KERNEL_EXPORT void buffer(Info& c, unsigned int k);
   public:
     /// Initialize
     GPI(void);
@@ -86,6 +115,18 @@ namespace Gecode { namespace Kernel {
     void decay(double d);
     /// Return decay factor
     double decay(void) const;
+    /**
+     * \brief Merge failures of a thread after \a k failures
+     *
+     * For \a k greater than one, each thread records its failures
+     * in a thread-local buffer and updates the shared afc values
+     * only after \a k failures. This avoids contention when many
+     * threads search on clones of the same space, at the expense
+     * of afc values that might lag slightly behind.
+     */
+    void merge(unsigned int k);
+    /// Return after how many failures the failures of a thread are merged
+    unsigned int merge(void) const;
     /// Increment failure count
     void fail(Info& c);
     /// Allocate info for existing propagator with pid \a p
@@ -118,18 +159,45 @@ namespace Gecode { namespace Kernel {
   }
 
 
+  forceinline
+  GPI::Buffer::Buffer(const void* o, Buffer* n0)
+    : owner(o), n(0U), next(n0) {}
+
+
   forceinline
   GPI::GPI(void)
-    : b(&fst), invd(1.0), npid(0U), us(false) {}
+    : b(&fst), invd(1.0), npid(0U), us(false), mc(1U), bs(nullptr),
+      id(ids.fetch_add(1ULL, std::memory_order_relaxed) + 1ULL) {}
 
   forceinline void
-  GPI::fail(Info& c) {
-    m.acquire();
+  GPI::count(Info& c) {
     c.afc = invd * (c.afc + 1.0);
     if (c.afc > Kernel::Config::rescale_limit)
       for (Block* i = b; i != nullptr; i = i->next)
         i->rescale();
-    m.release();
+  }
+
+  forceinline void
+  GPI::fail(Info& c) {
+    unsigned int k = mc.load(std::memory_order_relaxed);
+    if (k > 1U) {
+      buffer(c,k);
+    } else {
+      m.acquire();
+      count(c);
+      m.release();
+    }
+  }
+
+  forceinline void
+  GPI::merge(unsigned int k) {
+    mc.store(std::max(std::min(k,Buffer::n_info),1U),
+             std::memory_order_relaxed);
+  }
+
+  forceinline unsigned int
+  GPI::merge(void) const {
+    return mc.load(std::memory_order_relaxed);
   }
 
   forceinline double
@@ -192,6 +260,11 @@ namespace Gecode { namespace Kernel {
 
   forceinline
   GPI::~GPI(void) {
+    while (bs != nullptr) {
+      Buffer* d = bs;
+      bs = bs->next;
+      delete d;
+    }
     Block* n = b;
     while (n != &fst) {
       Block* d = n;
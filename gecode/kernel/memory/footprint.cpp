@@ -0,0 +1,93 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/kernel.hh>
+
+#include <typeinfo>
+
+#ifdef __GNUG__
+#include <cxxabi.h>
+#endif
+
+namespace Gecode {
+
+  std::string
+  MemoryFootprint::name(const char* n) {
+#ifdef __GNUG__
+    int status = 0;
+    char* d = abi::__cxa_demangle(n, nullptr, nullptr, &status);
+    if (d != nullptr) {
+      std::string s(d);
+      std::free(d);
+      return s;
+    }
+#endif
+    return std::string(n);
+  }
+
+  void
+  Space::footprint(MemoryFootprint& mf) {
+    mf.heap += mm.heap();
+    mf.subscriptions += pc.p.n_sub * sizeof(ActorLink*);
+    if (failed())
+      return;
+    if (!stable())
+      throw SpaceNotStable("Space::footprint");
+    /*
+     * Actors are measured on a clone: the size of an actor is only
+     * available from its dispose function. After all actors have been
+     * disposed, nothing is left for forced disposal by the clone's
+     * destructor.
+     */
+    Space* c = _clone();
+    {
+      ActorLink* e = &c->pl;
+      ActorLink* a = e->next();
+      while (a != e) {
+        Actor* p = Actor::cast(a); a = a->next();
+        std::string n(MemoryFootprint::name(typeid(*p).name()));
+        ActorLink::cast(p)->unlink();
+        MemoryFootprint::add(mf.propagators, n, p->dispose(*c));
+      }
+    }
+    {
+      ActorLink* e = &c->bl;
+      ActorLink* a = e->next();
+      while (a != e) {
+        Actor* b = Actor::cast(a); a = a->next();
+        std::string n(MemoryFootprint::name(typeid(*b).name()));
+        ActorLink::cast(b)->unlink();
+        MemoryFootprint::add(mf.branchers, n, b->dispose(*c));
+      }
+    }
+    c->d_cur = c->d_fst;
+    delete c;
+  }
+
+}
+
+// STATISTICS: kernel-memory
@@ -0,0 +1,106 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <map>
+#include <string>
+
+namespace Gecode {
+
+  /**
+   * \brief Breakdown of the memory used by a space
+   *
+   * A memory footprint is filled by Space::footprint. The kernel
+   * accounts for the space heap, subscriptions, and all actors
+   * (keyed by their class name). Variables and shared objects are
+   * only known to the modules defining them and are added by
+   * spaces that refine Space::footprint.
+   *
+   * \ingroup FuncMem
+   */
+  class MemoryFootprint {
+  public:
+    /// Number of entities and the memory they use
+    class Entry {
+    public:
+      /// Number of entities
+      unsigned long int n;
+      /// Memory in bytes
+      size_t bytes;
+      /// Initialize as empty
+      Entry(void);
+    };
+    /// Map from names to entries
+    typedef std::map<std::string,Entry> Entries;
+    /// Total amount of heap memory requested by the space
+    size_t heap;
+    /// Memory used for subscriptions
+    size_t subscriptions;
+    /// Propagators by class name
+    Entries propagators;
+    /// Branchers by class name
+    Entries branchers;
+    /// Variables by variable type
+    Entries variables;
+    /// Shared objects by type (each object counted once)
+    Entries shared;
+    /// Initialize as empty
+    MemoryFootprint(void);
+    /// Add \a bytes for an entity named \a name to \a e
+    static void add(Entries& e, const std::string& name, size_t bytes);
+    /// Return total number of bytes in \a e
+    static size_t bytes(const Entries& e);
+    /// Return readable name for type name \a n as returned by \c typeid
+    GECODE_KERNEL_EXPORT
+    static std::string name(const char* n);
+  };
+
+
+  forceinline
+  MemoryFootprint::Entry::Entry(void)
+    : n(0UL), bytes(0) {}
+
+  forceinline
+  MemoryFootprint::MemoryFootprint(void)
+    : heap(0), subscriptions(0) {}
+
+  forceinline void
+  MemoryFootprint::add(Entries& e, const std::string& name, size_t bytes) {
+    Entry& f = e[name];
+    f.n++; f.bytes += bytes;
+  }
+
+  forceinline size_t
+  MemoryFootprint::bytes(const Entries& e) {
+    size_t b = 0;
+    for (Entries::const_iterator i = e.begin(); i != e.end(); ++i)
+      b += i->second.bytes;
+    return b;
+  }
+
+}
+
+// STATISTICS: kernel-memory
@@ -762,6 +762,8 @@ namespace Gecode { namespace Search {
       unsigned int slice;
       /// Depth limit for extraction of no-goods
       unsigned int nogoods_limit;
+      /// Depth limit for learning no-goods from failures (0 disables learning)
+      unsigned int nogoods_learn;
       /// Stop object for stopping search
       Stop* stop;
       /// Cutoff for restart-based search
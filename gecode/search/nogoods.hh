@@ -84,6 +84,9 @@ namespace Gecode { namespace Search {
     /// Post propagator for path \a p
     template<class Path>
     static ExecStatus post(Space& home, const Path& p);
+    /// Post no-good for the \a n decisions at positions \a e of path \a p
+    template<class Path>
+    static ExecStatus post(Space& home, const Path& p, const int* e, int n);
     /// Delete propagator and return its size
     virtual size_t dispose(Space& home);
   };
@@ -171,6 +171,44 @@ namespace Gecode { namespace Search {
     return ES_OK;
   }
 
+  template<class Path>
+  forceinline ExecStatus
+  NoGoodsProp::post(Space& home, const Path& p, const int* e, int n) {
+    assert(n > 0);
+    // A sentinel element
+    NoNGL nn;
+    // Current no-good literal
+    NGL* c = &nn;
+
+    // Create a chain of literals where only the last one is a leaf
+    for (int i=0; i<n; i++) {
+      const typename Path::Edge& d = p.ds[e[i]];
+      NGL* l = home.ngl(*d.choice(),d.truealt());
+      if (l == nullptr) {
+        // The brancher does not support no-goods
+        NGL* f = nn.next();
+        while (f != nullptr) {
+          NGL* t = f->next();
+          home.rfree(f,f->dispose(home));
+          f = t;
+        }
+        return ES_OK;
+      }
+      c = c->add(l,i+1 == n);
+    }
+
+    if (n == 1) {
+      // A single literal can be pruned right away
+      NGL* l = nn.next();
+      ExecStatus es = l->prune(home);
+      home.rfree(l,l->dispose(home));
+      return es;
+    }
+
+    (void) new (home) NoGoodsProp(home,nn.next());
+    return ES_OK;
+  }
+
 }}
 
 // STATISTICS: search-other
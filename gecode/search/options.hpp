@@ -39,7 +39,7 @@ namespace Gecode { namespace Search {
       threads(Config::threads),
       c_d(Config::c_d), a_d(Config::a_d),
       d_l(Config::d_l),
-      assets(0), slice(Config::slice), nogoods_limit(0),
+      assets(0), slice(Config::slice), nogoods_limit(0), nogoods_learn(0),
       stop(nullptr), cutoff(nullptr), tracer(nullptr) {}
 
 }}
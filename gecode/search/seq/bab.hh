@@ -63,6 +63,8 @@ namespace Gecode { namespace Search { namespace Seq {
     int mark;
     /// Best solution found so far
     Space* best;
+    /// Root space for learning no-goods (nullptr if not learning)
+    Space* root;
   public:
     /// Initialize with space \a s and search options \a o
     BAB(Space* s, const Options& o);
@@ -41,7 +41,7 @@ namespace Gecode { namespace Search { namespace Seq {
   forceinline
   BAB<Tracer>::BAB(Space* s, const Options& o)
     : tracer(o.tracer), opt(o), path(opt.nogoods_limit), d(0), mark(0), 
-      best(nullptr) {
+      best(nullptr), root(nullptr) {
     if (tracer) {
       tracer.engine(SearchTracer::EngineType::BAB, 1U);
       tracer.worker();
@@ -53,6 +53,8 @@ namespace Gecode { namespace Search { namespace Seq {
         delete s;
     } else {
       cur = snapshot(s,opt);
+      if (opt.nogoods_learn > 0)
+        root = cur->clone();
     }
   }
 
@@ -105,6 +107,8 @@ namespace Gecode { namespace Search { namespace Seq {
         fail++;
         delete cur;
         cur = nullptr;
+        if (root != nullptr)
+          path.learn(*root,opt.nogoods_learn,*this,tracer);
         path.next();
         break;
       case SS_SOLVED:
@@ -121,6 +125,11 @@ namespace Gecode { namespace Search { namespace Seq {
           cur = nullptr;
           path.next();
           mark = path.entries();
+          // No-goods are learned with respect to the best solution
+          if (root != nullptr) {
+            root->constrain(*best);
+            (void) root->status(*this);
+          }
         }
         return best->clone();
       case SS_BRANCH:
@@ -170,6 +179,10 @@ namespace Gecode { namespace Search { namespace Seq {
     best = b.clone();
     if (cur != nullptr)
       cur->constrain(b);
+    if (root != nullptr) {
+      root->constrain(b);
+      (void) root->status(*this);
+    }
     mark = path.entries();
   }
 
@@ -183,11 +196,15 @@ namespace Gecode { namespace Search { namespace Seq {
     d = 0;
     mark = 0;
     delete cur;
+    delete root;
+    root = nullptr;
     if ((s == nullptr) || (s->status(*this) == SS_FAILED)) {
       delete s;
       cur = nullptr;
     } else {
       cur = s;
+      if (opt.nogoods_learn > 0)
+        root = cur->clone();
     }
     Worker::reset();
   }
@@ -205,6 +222,7 @@ namespace Gecode { namespace Search { namespace Seq {
     path.reset();
     delete best;
     delete cur;
+    delete root;
   }
 
 }}}
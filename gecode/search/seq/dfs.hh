@@ -53,6 +53,8 @@ namespace Gecode { namespace Search { namespace Seq {
     Path<Tracer> path;
     /// Current space being explored
     Space* cur;
+    /// Root space for learning no-goods (nullptr if not learning)
+    Space* root;
     /// Distance until next clone
     unsigned int d;
   public:
@@ -36,7 +36,8 @@ namespace Gecode { namespace Search { namespace Seq {
   template<class Tracer>
   forceinline
   DFS<Tracer>::DFS(Space* s, const Options& o)
-    : tracer(o.tracer), opt(o), path(opt.nogoods_limit), d(0) {
+    : tracer(o.tracer), opt(o), path(opt.nogoods_limit), root(nullptr),
+      d(0) {
     if (tracer) {
       tracer.engine(SearchTracer::EngineType::DFS, 1U);
       tracer.worker();
@@ -48,6 +49,8 @@ namespace Gecode { namespace Search { namespace Seq {
         delete s;
     } else {
       cur = snapshot(s,opt);
+      if (opt.nogoods_learn > 0)
+        root = cur->clone();
     }
   }
 
@@ -56,6 +59,8 @@ namespace Gecode { namespace Search { namespace Seq {
   DFS<Tracer>::reset(Space* s) {
     tracer.round();
     delete cur;
+    delete root;
+    root = nullptr;
     path.reset();
     d = 0;
     if ((s == nullptr) || (s->status(*this) == SS_FAILED)) {
@@ -63,6 +68,8 @@ namespace Gecode { namespace Search { namespace Seq {
       cur = nullptr;
     } else {
       cur = s;
+      if (opt.nogoods_learn > 0)
+        root = cur->clone();
     }
     Worker::reset();
   }
@@ -116,6 +123,8 @@ namespace Gecode { namespace Search { namespace Seq {
         fail++;
         delete cur;
         cur = nullptr;
+        if (root != nullptr)
+          path.learn(*root,opt.nogoods_learn,*this,tracer);
         path.next();
         break;
       case SS_SOLVED:
@@ -176,6 +185,7 @@ namespace Gecode { namespace Search { namespace Seq {
   forceinline
   DFS<Tracer>::~DFS(void) {
     delete cur;
+    delete root;
     tracer.done();
     path.reset();
   }
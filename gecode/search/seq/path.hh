@@ -143,6 +143,18 @@ namespace Gecode { namespace Search { namespace Seq {
     int entries(void) const;
     /// Reset stack
     void reset(void);
+    /**
+     * \brief Learn a no-good from the failure of the current path
+     *
+     * The failure is explained by re-propagation: decisions of the
+     * path (if it has at most \a l entries) are committed to a clone
+     * of the root space \a r until propagation fails, which yields a
+     * small subset of the decisions that is sufficient for failure.
+     * The resulting no-good is posted to \a r and to all clones on
+     * the path. The path is unwound below the deepest decision of
+     * the no-good (or below a clone that fails due to the no-good).
+     */
+    void learn(Space& r, unsigned int l, Worker& stat, Tracer& t);
     /// Post no-goods
     virtual void post(Space& home) const;
   };
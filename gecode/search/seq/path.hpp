@@ -380,6 +380,86 @@ namespace Gecode { namespace Search { namespace Seq {
     return s;
   }
 
+  template<class Tracer>
+  void
+  Path<Tracer>::learn(Space& r, unsigned int l, Worker& stat, Tracer& t) {
+    int n = ds.entries();
+    if ((n == 0) || (static_cast<unsigned int>(n) > l) || r.failed())
+      return;
+    // Candidate decisions and decisions in the explanation
+    int* c = heap.alloc<int>(n);
+    int* e = heap.alloc<int>(n);
+    int nc = n, ne = 0;
+    for (int i=0; i<n; i++)
+      c[i] = i;
+    /*
+     * Add the decision that makes propagation fail after committing
+     * the explanation and the candidates in path order to the
+     * explanation, until the explanation alone fails.
+     */
+    while (true) {
+      Space* s = r.clone();
+      for (int i=0; i<ne; i++)
+        s->trycommit(*ds[e[i]].choice(),ds[e[i]].truealt());
+      if (s->status(stat) == SS_FAILED) {
+        delete s;
+        break;
+      }
+      int f = -1;
+      for (int i=0; i<nc; i++) {
+        s->trycommit(*ds[c[i]].choice(),ds[c[i]].truealt());
+        if (s->status(stat) == SS_FAILED) {
+          f = i; break;
+        }
+      }
+      delete s;
+      if (f < 0) {
+        // Failure cannot be explained by propagation from the root
+        heap.free<int>(c,n);
+        heap.free<int>(e,n);
+        return;
+      }
+      e[ne++] = c[f]; nc = f;
+    }
+    // Literals must follow path order
+    Support::insertion(e,ne);
+    stat.nogood++;
+
+    // The root space fails: there are no further solutions
+    if ((NoGoodsProp::post(r,*this,e,ne) == ES_FAILED) ||
+        (r.status(stat) == SS_FAILED)) {
+      r.fail();
+      if (!ds.empty() && (ds[0].space() != nullptr))
+        ds[0].space()->fail();
+      unwind(0,t);
+      heap.free<int>(c,n);
+      heap.free<int>(e,n);
+      return;
+    }
+
+    // Post to all clones that are not below the deepest decision
+    int m = e[ne-1];
+    for (int i=0; i<=m; i++)
+      if (Space* s = ds[i].space()) {
+        if ((NoGoodsProp::post(*s,*this,e,ne) == ES_FAILED) ||
+            (s->status(stat) == SS_FAILED)) {
+          s->fail();
+          stat.fail++;
+          m = i-1;
+          break;
+        }
+      }
+    heap.free<int>(c,n);
+    heap.free<int>(e,n);
+
+    // Skip all nodes below the deepest decision of the no-good
+    if (m+1 < n) {
+      if (Space* s = ds[m+1].space())
+        s->fail();
+      unwind(m+1,t);
+    }
+  }
+
   template<class Tracer>
   void
   Path<Tracer>::post(Space& home) const {
@@ -134,6 +134,68 @@ namespace Test {
 
   AFC afc;
 
+  /// %Test for merging of %AFC information after several failures
+  class AFCMerge : public Test::Base {
+  protected:
+    /// Test space
+    class TestSpace : public Gecode::Space {
+    public:
+      /// Two integer variables
+      Gecode::IntVar x, y;
+      /// Constructor for creation
+      TestSpace(void) : x(*this,0,10), y(*this,0,10) {
+        Gecode::rel(*this, x, Gecode::IRT_LE, y);
+      }
+      /// Constructor for cloning \a s
+      TestSpace(TestSpace& s) : Space(s) {
+        x.update(*this,s.x);
+        y.update(*this,s.y);
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new TestSpace(*this);
+      }
+      /// Fail a clone of the space
+      void fail(void) {
+        TestSpace* c = static_cast<TestSpace*>(clone());
+        Gecode::rel(*c, c->x, Gecode::IRT_GQ, 5);
+        Gecode::rel(*c, c->y, Gecode::IRT_LQ, 5);
+        (void) c->status();
+        delete c;
+      }
+      /// Return afc value of the only propagator
+      double afc(void) {
+        Gecode::Propagators ps(*this, Gecode::PropagatorGroup::all);
+        return ps.propagator().afc();
+      }
+    };
+  public:
+    /// Initialize test
+    AFCMerge(void) : Test::Base("AFC::Merge") {}
+    /// Perform actual tests
+    bool run(void) {
+      TestSpace* s = new TestSpace;
+      (void) s->status();
+      s->afc_decay(1.0);
+      s->afc_merge(4);
+      bool ok = (s->afc_merge() == 4U);
+      for (int i=0; i<3; i++)
+        s->fail();
+      // Failures are only buffered
+      ok = ok && (s->afc() == 1.0);
+      s->fail();
+      // All four failures are merged
+      ok = ok && (s->afc() == 5.0);
+      s->afc_merge(1);
+      s->fail();
+      ok = ok && (s->afc() == 6.0);
+      delete s;
+      return ok;
+    }
+  };
+
+  AFCMerge afcmerge;
+
 }
 
 // STATISTICS: test-core
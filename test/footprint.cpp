@@ -0,0 +1,92 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/kernel.hh>
+#include <gecode/int.hh>
+
+#include "test/test.hh"
+
+namespace Test {
+
+  /// %Test for memory footprint of a space
+  class Footprint : public Test::Base {
+  protected:
+    /// Test space
+    class TestSpace : public Gecode::Space {
+    public:
+      /// Integer variables
+      Gecode::IntVarArray x;
+      /// Constructor for creation
+      TestSpace(void) : x(*this,3,0,10) {
+        Gecode::rel(*this, x[0], Gecode::IRT_LE, x[1]);
+        Gecode::rel(*this, x[1], Gecode::IRT_LE, x[2]);
+        Gecode::distinct(*this, x, Gecode::IPL_DOM);
+        Gecode::branch(*this, x, Gecode::INT_VAR_NONE(),
+                       Gecode::INT_VAL_MIN());
+      }
+      /// Constructor for cloning \a s
+      TestSpace(TestSpace& s) : Space(s) {
+        x.update(*this,s.x);
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new TestSpace(*this);
+      }
+    };
+  public:
+    /// Initialize test
+    Footprint(void) : Test::Base("Footprint") {}
+    /// Perform actual tests
+    bool run(void) {
+      TestSpace* s = new TestSpace;
+      (void) s->status();
+      Gecode::MemoryFootprint mf;
+      s->footprint(mf);
+      unsigned long int n_p = 0;
+      for (const auto& e : mf.propagators)
+        n_p += e.second.n;
+      unsigned long int n_b = 0;
+      for (const auto& e : mf.branchers)
+        n_b += e.second.n;
+      bool ok = (n_p == Gecode::PropagatorGroup::all.size(*s)) &&
+        (n_b == Gecode::BrancherGroup::all.size(*s)) &&
+        (mf.heap > 0) && (mf.subscriptions > 0) &&
+        (Gecode::MemoryFootprint::bytes(mf.propagators) > 0);
+      // The space must be unaffected and still be able to propagate
+      Gecode::rel(*s, s->x[0], Gecode::IRT_EQ, 1);
+      ok = ok && (s->status() == Gecode::SS_BRANCH) &&
+        (s->x[1].min() == 2);
+      delete s;
+      return ok;
+    }
+  };
+
+  Footprint footprint;
+
+}
+
+// STATISTICS: test-core
@@ -49,11 +49,15 @@ namespace Test { namespace Int {
      private:
        /// Offset
        int offset;
+       /// Number of executions between connectivity checks
+       unsigned int scc;
      public:
        /// Create and register test
-       Circuit(int n, int min, int max, int off, Gecode::IntPropLevel ipl)
-         : Test("Circuit::" + str(ipl) + "::" + str(n) + "::" + str(off),
-                n,min,max,false,ipl), offset(off) {
+       Circuit(int n, int min, int max, int off, Gecode::IntPropLevel ipl,
+               unsigned int scc0=1U)
+         : Test("Circuit::" + str(ipl) + "::" + str(n) + "::" + str(off) +
+                ((scc0 > 1U) ? "::SCC::" + str(static_cast<int>(scc0)) : ""),
+                n,min,max,false,ipl), offset(off), scc(scc0) {
          contest = CTL_NONE;
          testfix = false;
        }
@@ -80,9 +84,9 @@ namespace Test { namespace Int {
            Gecode::IntVarArgs xx(x.size());
            for (int i=x.size(); i--;)
              xx[i] = Gecode::expr(home, x[i]+offset);
-           Gecode::circuit(home, offset, xx, ipl);
+           Gecode::circuit(home, offset, xx, ipl, scc);
          } else {
-           Gecode::circuit(home, x, ipl);
+           Gecode::circuit(home, x, ipl, scc);
          }
        }
      };
@@ -145,11 +149,19 @@ namespace Test { namespace Int {
      private:
        /// Offset
        int offset;
+       /// Whether edge costs depend on both nodes
+       bool mixed;
+       /// Cost of edge from \a i to \a j
+       int cost(int i, int j) const {
+         return mixed ? ((i+1)*(j+2)) % 5 : j;
+       }
      public:
        /// Create and register test
-       CircuitCost(int n, int min, int max, int off, Gecode::IntPropLevel ipl)
-         : Test("Circuit::Cost::"+str(ipl)+"::"+str(n)+"::"+str(off),
-                n+1,min,max,false,ipl), offset(off) {
+       CircuitCost(int n, int min, int max, int off, Gecode::IntPropLevel ipl,
+                   bool m=false)
+         : Test("Circuit::Cost::"+str(ipl)+"::"+str(n)+"::"+str(off)+
+                (m ? "::Mixed" : ""),
+                n+1,min,max,false,ipl), offset(off), mixed(m) {
          contest = CTL_NONE;
          testfix = false;
        }
@@ -171,7 +183,7 @@ namespace Test { namespace Int {
              return false;
          int c=0;
          for (int i=n; i--; )
-           c += x[i];
+           c += cost(i,x[i]);
          return c == x[n];
        }
        /// Post circuit constraint on \a x
@@ -181,7 +193,7 @@ namespace Test { namespace Int {
          IntArgs c(n*n);
          for (int i=0; i<n; i++)
            for (int j=0; j<n; j++)
-             c[i*n+j]=j;
+             c[i*n+j]=cost(i,j);
          IntVarArgs y(n);
          if (offset > 0) {
            for (int i=n; i--;)
@@ -329,6 +341,8 @@ namespace Test { namespace Int {
            (void) new Circuit(i,0,i-1,0,Gecode::IPL_DOM);
            (void) new Circuit(i,0,i-1,5,Gecode::IPL_VAL);
            (void) new Circuit(i,0,i-1,5,Gecode::IPL_DOM);
+           (void) new Circuit(i,0,i-1,0,Gecode::IPL_VAL,3U);
+           (void) new Circuit(i,0,i-1,5,Gecode::IPL_DOM,3U);
          }
          for (int i=1; i<=4; i++) {
            (void) new Path(i,0,i-1,0,Gecode::IPL_VAL);
@@ -342,6 +356,17 @@ namespace Test { namespace Int {
          (void) new CircuitFullCost(3,0,3,0,Gecode::IPL_DOM);
          (void) new CircuitCost(4,0,9,5,Gecode::IPL_VAL);
          (void) new CircuitCost(4,0,9,5,Gecode::IPL_DOM);
+         // Propagate lower bound from assignment
+         const Gecode::IntPropLevel val_a = static_cast<Gecode::IntPropLevel>
+           (Gecode::IPL_VAL | Gecode::IPL_ADVANCED);
+         const Gecode::IntPropLevel dom_a = static_cast<Gecode::IntPropLevel>
+           (Gecode::IPL_DOM | Gecode::IPL_ADVANCED);
+         (void) new CircuitCost(4,0,9,0,val_a);
+         (void) new CircuitCost(4,0,9,5,dom_a);
+         (void) new CircuitCost(4,0,9,0,Gecode::IPL_DOM,true);
+         (void) new CircuitCost(4,0,9,0,dom_a,true);
+         (void) new CircuitCost(4,0,9,5,val_a,true);
+         (void) new CircuitFullCost(3,0,3,0,dom_a);
          (void) new CircuitFullCost(3,0,3,5,Gecode::IPL_VAL);
          (void) new CircuitFullCost(3,0,3,5,Gecode::IPL_DOM);
          (void) new PathCost(3,0,5,0,Gecode::IPL_VAL);
@@ -36,6 +36,8 @@
 #include "test/int.hh"
 #include <gecode/minimodel.hh>
 
+#include <vector>
+
 namespace Test { namespace Int {
 
    /// %Tests for distinct constraints
@@ -256,6 +258,143 @@ namespace Test { namespace Int {
        }
      };
 
+     /**
+      * \brief %Test domain consistency for many views under changes
+      *
+      * Posts domain consistent distinct for views with random dense
+      * domains and then repeatedly assigns or excludes random values.
+      * After each change the domains are compared to the values that
+      * have support, computed from a maximum matching.
+      */
+     class Incremental : public Base {
+     protected:
+       /// Number of views
+       int n;
+       /// Number of values
+       int w;
+       /// %Test space
+       class TestSpace : public Gecode::Space {
+       public:
+         /// The views
+         Gecode::IntVarArray x;
+         /// Constructor
+         TestSpace(int n) : x(*this,n) {}
+         /// Constructor for cloning \a s
+         TestSpace(TestSpace& s) : Gecode::Space(s) {
+           x.update(*this,s.x);
+         }
+         /// Copy space during cloning
+         virtual Gecode::Space* copy(void) {
+           return new TestSpace(*this);
+         }
+       };
+       /// Try to match view \a i in domains \a d with matching \a m
+       bool augment(const std::vector<std::vector<bool> >& d,
+                    std::vector<int>& m, std::vector<bool>& vs,
+                    int i) const {
+         for (int v=0; v<w; v++)
+           if (d[i][v] && !vs[v]) {
+             vs[v] = true;
+             if ((m[v] < 0) || augment(d,m,vs,m[v])) {
+               m[v] = i; return true;
+             }
+           }
+         return false;
+       }
+       /// Compute matching \a m for domains \a d, return whether complete
+       bool match(const std::vector<std::vector<bool> >& d,
+                  std::vector<int>& m) const {
+         m.assign(w,-1);
+         for (int i=0; i<n; i++) {
+           std::vector<bool> vs(w,false);
+           if (!augment(d,m,vs,i))
+             return false;
+         }
+         return true;
+       }
+       /// Test whether view \a i can take value \a v with domains \a d
+       bool support(std::vector<std::vector<bool> > d,
+                    const std::vector<int>& m0, int i, int v) const {
+         if (m0[v] == i)
+           return true;
+         std::vector<int> m(m0);
+         int j = m[v];
+         for (int u=0; u<w; u++)
+           if (m[u] == i)
+             m[u] = -1;
+         m[v] = i;
+         d[i].assign(w,false); d[i][v] = true;
+         if (j < 0)
+           return true;
+         d[j][v] = false;
+         std::vector<bool> vs(w,false);
+         return augment(d,m,vs,j);
+       }
+     public:
+       /// Create and register test
+       Incremental(int n0, int w0)
+         : Base("Int::Distinct::Incremental::"+
+                Test::str(n0)+"::"+Test::str(w0)), n(n0), w(w0) {}
+       /// Perform test
+       virtual bool run(void) {
+         using namespace Gecode;
+         TestSpace* s = new TestSpace(n);
+         for (int i=0; i<n; i++) {
+           IntArgs a;
+           for (int v=0; v<w; v++)
+             if (_rand(2U) == 0U)
+               a << v;
+           if (a.size() == 0)
+             a << static_cast<int>(_rand(static_cast<unsigned int>(w)));
+           s->x[i] = IntVar(*s,IntSet(a));
+         }
+         distinct(*s,s->x,IPL_DOM);
+         while (true) {
+           std::vector<std::vector<bool> > d(n,std::vector<bool>(w,false));
+           for (int i=0; i<n; i++)
+             for (IntVarValues v(s->x[i]); v(); ++v)
+               d[i][v.val()] = true;
+           std::vector<int> m;
+           bool complete = match(d,m);
+           if (s->status() == SS_FAILED) {
+             delete s;
+             return !complete;
+           }
+           if (!complete) {
+             delete s; return false;
+           }
+           for (int i=0; i<n; i++)
+             for (int v=0; v<w; v++)
+               if (d[i][v] && (s->x[i].in(v) != support(d,m,i,v))) {
+                 delete s; return false;
+               }
+           IntArgs u;
+           for (int i=0; i<n; i++)
+             if (!s->x[i].assigned())
+               u << i;
+           if (u.size() == 0)
+             break;
+           if (_rand(4U) == 0U) {
+             TestSpace* c = static_cast<TestSpace*>(s->clone());
+             delete s; s = c;
+           }
+           int i = u[static_cast<int>(_rand(static_cast<unsigned int>
+                                            (u.size())))];
+           IntArgs a;
+           for (IntVarValues v(s->x[i]); v(); ++v)
+             a << v.val();
+           int v = a[static_cast<int>(_rand(static_cast<unsigned int>
+                                            (a.size())))];
+           rel(*s, s->x[i], (_rand(3U) == 0U) ? IRT_EQ : IRT_NQ, v);
+         }
+         delete s;
+         return true;
+       }
+     };
+
+     Incremental i_36_40(36,40);
+     Incremental i_40_40(40,40);
+
      const int v[7] = {-1001,-1000,-10,0,10,1000,1001};
      Gecode::IntSet d(v,7);
      const int vl[6] = {Gecode::Int::Limits::min+0,
@@ -87,6 +87,23 @@ namespace Test { namespace Int {
      };
 
 
+     /// %Test for domain constraint (integer array)
+     class DomInts : public Test {
+     public:
+       /// Create and register test
+       DomInts(void)
+         : Test("Dom::Ints",3,-4,4,false,Gecode::IPL_DOM) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         return (x[0] == -2) && (x[1] == 0) && (x[2] == 3);
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         Gecode::dom(home, x, Gecode::IntArgs({-2,0,3}));
+       }
+     };
+
+
      /// %Test for domain constraint (range)
      class DomRange : public Test {
      public:
@@ -200,6 +217,7 @@ namespace Test { namespace Int {
 
      DomInt di1(1);
      DomInt di3(3);
+     DomInts dis;
      DomRange dr1(1);
      DomRange dr3(3);
      DomDom dd1(1);
@@ -39,6 +39,7 @@
 
 #include <gecode/minimodel.hh>
 #include <climits>
+#include <cstdio>
 
 namespace Test { namespace Int {
 
@@ -387,6 +388,15 @@ namespace Test { namespace Int {
        return dfa;
      }
 
+     ///% Write a TupleSet to a file and read it back
+     Gecode::TupleSet viaFile(const Gecode::TupleSet& ts) {
+       const std::string fn("gecode-test-tuple-set.tmp");
+       ts.write(fn);
+       Gecode::TupleSet t(fn);
+       (void) std::remove(fn.c_str());
+       return t;
+     }
+
      /// %Test with tuple set
      class TupleSetBase : public Test {
      protected:
@@ -449,10 +459,13 @@ namespace Test { namespace Int {
      public:
        /// Create and register test
        TupleSetTest(const std::string& s, bool p,
-                    Gecode::IntSet d0, Gecode::TupleSet ts0, bool td)
-         : Test("Extensional::TupleSet::" + str(p) + "::" + s,
-                ts0.arity(),d0,true,Gecode::IPL_DOM),
+                    Gecode::IntSet d0, Gecode::TupleSet ts0, bool td,
+                    Gecode::IntPropLevel ipl0=Gecode::IPL_DOM)
+         : Test("Extensional::TupleSet::" + str(p) + "::" + s +
+                ((ipl0 == Gecode::IPL_DOM) ? "" : "::" + str(ipl0)),
+                ts0.arity(),d0,true,ipl0),
            pos(p), ts(ts0), toDFA(td) {
+         contest = CTL_DOMAIN;
        }
        /// %Test whether \a x is solution
        virtual bool solution(const Assignment& x) const {
@@ -489,8 +502,9 @@ namespace Test { namespace Int {
      public:
        /// Create and register test
        RandomTupleSetTest(const std::string& s, bool p,
-                          Gecode::IntSet d0, Gecode::TupleSet ts0)
-         : TupleSetTest(s,p,d0,ts0,false) {
+                          Gecode::IntSet d0, Gecode::TupleSet ts0,
+                          Gecode::IntPropLevel ipl0=Gecode::IPL_DOM)
+         : TupleSetTest(s,p,d0,ts0,false,ipl0) {
          testsearch = false;
        }
        /// Create and register initial assignment
@@ -669,6 +683,8 @@ namespace Test { namespace Int {
          Gecode::Support::RandomGenerator rand(42);
 
          using namespace Gecode;
+         // Propagate positive tuple sets as MDDs
+         const IntPropLevel mdd = IPL_ADVANCED;
          for (bool pos : { false, true }) {
            {
              TupleSet ts(4);
@@ -679,11 +695,16 @@ namespace Test { namespace Int {
                .add({1, 5, 2, 5}).add({5, 3, 3, 2})
                .finalize();
              (void) new TupleSetTest("A",pos,IntSet(0,6),ts,true);
+             (void) new TupleSetTest("A",pos,IntSet(0,6),ts,false,mdd);
+             (void) new TupleSetTest("File::A",pos,IntSet(0,6),
+                                     viaFile(ts),false);
            }
            {
              TupleSet ts(4);
              ts.finalize();
              (void) new TupleSetTest("Empty",pos,IntSet(1,2),ts,true);
+             (void) new TupleSetTest("File::Empty",pos,IntSet(1,2),
+                                     viaFile(ts),false);
            }
            {
              TupleSet ts(4);
@@ -696,6 +717,7 @@ namespace Test { namespace Int {
              TupleSet ts(1);
              ts.add({1}).add({2}).add({3}).finalize();
              (void) new TupleSetTest("Single",pos,IntSet(-4,4),ts,true);
+             (void) new TupleSetTest("Single",pos,IntSet(-4,4),ts,false,mdd);
            }
            {
              int m = Gecode::Int::Limits::min;
@@ -705,6 +727,7 @@ namespace Test { namespace Int {
                .add({m+1,m+2,m+5}).add({m+2,m+3,m+0})
                .add({m+3,m+6,m+5}).finalize();
              (void) new TupleSetTest("Min",pos,IntSet(m,m+7),ts,true);
+             (void) new TupleSetTest("Min",pos,IntSet(m,m+7),ts,false,mdd);
            }
            {
              int M = Gecode::Int::Limits::max;
@@ -714,6 +737,7 @@ namespace Test { namespace Int {
                .add({M-1,M-2,M-5}).add({M-2,M-3,M-0})
                .add({M-3,M-6,M-5}).finalize();
              (void) new TupleSetTest("Max",pos,IntSet(M-7,M),ts,true);
+             (void) new TupleSetTest("Max",pos,IntSet(M-7,M),ts,false,mdd);
            }
            {
              int m = Gecode::Int::Limits::min;
@@ -737,6 +761,7 @@ namespace Test { namespace Int {
              }
              ts.finalize();
              (void) new RandomTupleSetTest("Triangle",pos,IntSet(0,6),ts);
+             (void) new RandomTupleSetTest("Triangle",pos,IntSet(0,6),ts,mdd);
            }
            {
              for (int i = 0; i <= 64*6; i+=32)
@@ -763,6 +788,7 @@ namespace Test { namespace Int {
              t.add({2,2,4,3,4});
              t.finalize();
              (void) new TupleSetTest("FewLast",pos,IntSet(1,4),t,false);
+             (void) new TupleSetTest("FewLast",pos,IntSet(1,4),t,false,mdd);
            }
            {
              TupleSet t(4);
@@ -774,6 +800,8 @@ namespace Test { namespace Int {
              t.add({2,-1,3,4});
              t.finalize();
              (void) new TupleSetTest("FewMiddle",pos,IntSet(-1,6),t,false);
+             (void) new TupleSetTest("FewMiddle",pos,IntSet(-1,6),t,false,
+                                     mdd);
            }
            {
              TupleSet t(10);
@@ -791,6 +819,9 @@ namespace Test { namespace Int {
              t.add({1,2,3,4,4,2,1,2,3,3});
              t.finalize();
              (void) new RandomTupleSetTest("FewHuge",pos,IntSet(1,4),t);
+             (void) new RandomTupleSetTest("FewHuge",pos,IntSet(1,4),t,mdd);
+             (void) new RandomTupleSetTest("File::FewHuge",pos,IntSet(1,4),
+                                           viaFile(t));
            }
            (void) new TupleSetBase(pos);
            (void) new TupleSetLarge(0.05,pos);
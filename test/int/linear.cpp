@@ -35,6 +35,8 @@
 
 #include <gecode/minimodel.hh>
 
+#include <algorithm>
+
 namespace Test { namespace Int {
 
    /// %Tests for linear constraints
@@ -257,6 +259,205 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test incremental propagation of linear constraints with many terms
+     class Incremental : public Base {
+     protected:
+       /// Number of variables
+       int n;
+       /// Integer relation type to propagate
+       Gecode::IntRelType irt;
+       /// Whether to use unit coefficients only
+       bool unit;
+       /// %Test space
+       class TestSpace : public Gecode::Space {
+       public:
+         /// Variables
+         Gecode::IntVarArray x;
+         /// Constructor
+         TestSpace(int n) : x(*this,n,-3,3) {}
+         /// Constructor for cloning \a s
+         TestSpace(TestSpace& s) : Gecode::Space(s) {
+           x.update(*this,s.x);
+         }
+         /// Copy space during cloning
+         virtual Gecode::Space* copy(void) {
+           return new TestSpace(*this);
+         }
+       };
+       /// Check that the bounds of \a x are consistent for \a a and \a c
+       bool consistent(const Gecode::IntVarArray& x,
+                       const Gecode::IntArgs& a, int c) const {
+         long long int sl = 0, su = 0, w = 0;
+         for (int i=0; i<n; i++) {
+           long long int l = static_cast<long long int>(a[i]) *
+             ((a[i] > 0) ? x[i].min() : x[i].max());
+           long long int u = static_cast<long long int>(a[i]) *
+             ((a[i] > 0) ? x[i].max() : x[i].min());
+           sl += l; su += u; w = std::max(w,u-l);
+         }
+         if ((irt != Gecode::IRT_GQ) && ((sl > c) || (w > c - sl)))
+           return false;
+         if ((irt != Gecode::IRT_LQ) && ((su < c) || (w > su - c)))
+           return false;
+         return true;
+       }
+     public:
+       /// Create and register test
+       Incremental(int n0, Gecode::IntRelType irt0, bool unit0)
+         : Base("Int::Linear::Incremental::"+Test::str(n0)+"::"+
+                Test::str(irt0)+"::"+(unit0 ? "Unit" : "Scale")),
+           n(n0), irt(irt0), unit(unit0) {}
+       /// Perform test
+       virtual bool run(void) {
+         using namespace Gecode;
+         // Generate a random solution
+         IntArgs a(n), v(n);
+         int c = 0;
+         for (int i=0; i<n; i++) {
+           a[i] = unit ? 1 : 1 + static_cast<int>(_rand(4));
+           if (_rand(2) == 0)
+             a[i] = -a[i];
+           v[i] = static_cast<int>(_rand(7)) - 3;
+           c += a[i]*v[i];
+         }
+         if (irt == IRT_LQ)
+           c += static_cast<int>(_rand(3));
+         else if (irt == IRT_GQ)
+           c -= static_cast<int>(_rand(3));
+         TestSpace* s = new TestSpace(n);
+         linear(*s, a, s->x, irt, c, unit ? IPL_BND : IPL_DEF);
+         while (true) {
+           // The solution must not be pruned
+           if (s->status() == SS_FAILED) {
+             delete s; return false;
+           }
+           for (int i=0; i<n; i++)
+             if (!s->x[i].in(v[i])) {
+               delete s; return false;
+             }
+           if (!consistent(s->x,a,c)) {
+             delete s; return false;
+           }
+           // Restrict a random unassigned variable
+           int i = static_cast<int>(_rand(static_cast<unsigned int>(n)));
+           int j = i;
+           while (s->x[j].assigned()) {
+             j = (j + 1) % n;
+             if (j == i) {
+               delete s; return true;
+             }
+           }
+           if (_rand(2) == 0)
+             rel(*s, s->x[j], IRT_LQ, v[j] + static_cast<int>
+                 (_rand(static_cast<unsigned int>(s->x[j].max()-v[j]+1))));
+           else
+             rel(*s, s->x[j], IRT_GQ, v[j] - static_cast<int>
+                 (_rand(static_cast<unsigned int>(v[j]-s->x[j].min()+1))));
+         }
+       }
+     };
+
+     /// %Test incremental propagation of pseudo-Boolean constraints
+     class BoolIncremental : public Base {
+     protected:
+       /// Number of variables
+       int n;
+       /// Integer relation type to propagate
+       Gecode::IntRelType irt;
+       /// %Test space
+       class TestSpace : public Gecode::Space {
+       public:
+         /// Variables
+         Gecode::BoolVarArray x;
+         /// Constructor
+         TestSpace(int n) : x(*this,n,0,1) {}
+         /// Constructor for cloning \a s
+         TestSpace(TestSpace& s) : Gecode::Space(s) {
+           x.update(*this,s.x);
+         }
+         /// Copy space during cloning
+         virtual Gecode::Space* copy(void) {
+           return new TestSpace(*this);
+         }
+       };
+       /// Check that the bounds of \a x are consistent for \a a and \a c
+       bool consistent(const Gecode::BoolVarArray& x,
+                       const Gecode::IntArgs& a, int c) const {
+         long long int sl = 0, su = 0, w = 0;
+         for (int i=0; i<n; i++) {
+           long long int l = static_cast<long long int>(a[i]) *
+             ((a[i] > 0) ? x[i].min() : x[i].max());
+           long long int u = static_cast<long long int>(a[i]) *
+             ((a[i] > 0) ? x[i].max() : x[i].min());
+           sl += l; su += u; w = std::max(w,u-l);
+         }
+         if ((irt != Gecode::IRT_GQ) && ((sl > c) || (w > c - sl)))
+           return false;
+         if ((irt != Gecode::IRT_LQ) && ((su < c) || (w > su - c)))
+           return false;
+         return true;
+       }
+     public:
+       /// Create and register test
+       BoolIncremental(int n0, Gecode::IntRelType irt0)
+         : Base("Int::Linear::Incremental::Bool::"+Test::str(n0)+"::"+
+                Test::str(irt0)),
+           n(n0), irt(irt0) {}
+       /// Perform test
+       virtual bool run(void) {
+         using namespace Gecode;
+         // Generate a random solution
+         IntArgs a(n), v(n);
+         int c = 0;
+         for (int i=0; i<n; i++) {
+           a[i] = 1 + static_cast<int>(_rand(4));
+           if (_rand(2) == 0)
+             a[i] = -a[i];
+           v[i] = static_cast<int>(_rand(2));
+           c += a[i]*v[i];
+         }
+         if (irt == IRT_LQ)
+           c += static_cast<int>(_rand(3));
+         else if (irt == IRT_GQ)
+           c -= static_cast<int>(_rand(3));
+         TestSpace* s = new TestSpace(n);
+         linear(*s, a, s->x, irt, c);
+         while (true) {
+           // The solution must not be pruned
+           if (s->status() == SS_FAILED) {
+             delete s; return false;
+           }
+           for (int i=0; i<n; i++)
+             if (!s->x[i].in(v[i])) {
+               delete s; return false;
+             }
+           if (!consistent(s->x,a,c)) {
+             delete s; return false;
+           }
+           // Assign a random unassigned variable to its solution value
+           int i = static_cast<int>(_rand(static_cast<unsigned int>(n)));
+           int j = i;
+           while (s->x[j].assigned()) {
+             j = (j + 1) % n;
+             if (j == i) {
+               delete s; return true;
+             }
+           }
+           rel(*s, s->x[j], IRT_EQ, v[j]);
+         }
+       }
+     };
+
+     Incremental inc_eq_unit(200,Gecode::IRT_EQ,true);
+     Incremental inc_eq_scale(200,Gecode::IRT_EQ,false);
+     Incremental inc_lq_unit(200,Gecode::IRT_LQ,true);
+     Incremental inc_lq_scale(200,Gecode::IRT_LQ,false);
+     Incremental inc_gq_scale(200,Gecode::IRT_GQ,false);
+
+     BoolIncremental inc_eq_bool(200,Gecode::IRT_EQ);
+     BoolIncremental inc_lq_bool(200,Gecode::IRT_LQ);
+     BoolIncremental inc_gq_bool(200,Gecode::IRT_GQ);
+
      /// Help class to create and register tests
      class Create {
      public:
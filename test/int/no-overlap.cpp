@@ -128,6 +128,66 @@ namespace Test { namespace Int {
       }
     };
 
+    /**
+     * \brief %Test for no-overlap with many rectangles
+     *
+     * Besides the rectangles to be placed, the test posts fixed unit
+     * squares: a row of them below the placement area and one square
+     * at coordinates (1,1). The number of rectangles is then large
+     * enough for the sweep-based propagator to be used.
+     */
+    class Sweep2 : public Test {
+    protected:
+      /// Width
+      Gecode::IntArgs w;
+      /// Height
+      Gecode::IntArgs h;
+      /// Number of fixed squares below the placement area
+      static const int f = 100;
+    public:
+      /// Create and register test with maximal coordinate value \a m
+      Sweep2(int m, const Gecode::IntArgs& w0, const Gecode::IntArgs& h0)
+        : Test("NoOverlap::Int::Sweep::2::"+str(m)+"::"+
+               str(w0)+"::"+str(h0),
+               2*w0.size(), 0, m-1),
+          w(w0), h(h0) {
+      }
+      /// %Test whether \a xy is solution
+      virtual bool solution(const Assignment& xy) const {
+        int n = xy.size() / 2;
+        for (int i=0; i<n; i++) {
+          int xi=xy[2*i+0], yi=xy[2*i+1];
+          if ((xi < 2) && (1 < xi + w[i]) && (yi < 2) && (1 < yi + h[i]))
+            return false;
+          for (int j=i+1; j<n; j++) {
+            int xj=xy[2*j+0], yj=xy[2*j+1];
+            if (!((xi + w[i] <= xj) || (xj + w[j] <= xi) ||
+                  (yi + h[i] <= yj) || (yj + h[j] <= yi)))
+              return false;
+          }
+        }
+        return true;
+      }
+      /// Post constraint on \a xy
+      virtual void post(Gecode::Space& home, Gecode::IntVarArray& xy) {
+        using namespace Gecode;
+        int n = xy.size() / 2;
+        IntVarArgs x(n+f+1), y(n+f+1);
+        IntArgs ws(n+f+1), hs(n+f+1);
+        for (int i=0; i<n; i++) {
+          x[i]=xy[2*i+0]; y[i]=xy[2*i+1];
+          ws[i]=w[i]; hs[i]=h[i];
+        }
+        for (int i=0; i<f; i++) {
+          x[n+i]=IntVar(home,i,i); y[n+i]=IntVar(home,-1,-1);
+          ws[n+i]=1; hs[n+i]=1;
+        }
+        x[n+f]=IntVar(home,1,1); y[n+f]=IntVar(home,1,1);
+        ws[n+f]=1; hs[n+f]=1;
+        nooverlap(home, x, ws, y, hs);
+      }
+    };
+
     /// %Test for no-overlap with variable dimensions (rectangles)
     class Var2 : public Test {
     public:
@@ -278,6 +338,10 @@ namespace Test { namespace Int {
           (void) new IntOpt2(m, s4, s3);
         }
 
+        (void) new Sweep2(3, s1, s1);
+        (void) new Sweep2(3, s4, s4);
+        (void) new Sweep2(4, s2, s3);
+
         (void) new Var2(2, 2);
         (void) new Var2(3, 2);
         (void) new Var2(1, 3);
@@ -364,14 +364,18 @@ namespace Test {
       unsigned int a_d;
       /// Number of threads
       unsigned int t;
+      /// Depth limit for learning no-goods
+      unsigned int l;
     public:
       /// Initialize test
       DFS(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
-          unsigned int c_d0, unsigned int a_d0, unsigned int t0)
+          unsigned int c_d0, unsigned int a_d0, unsigned int t0,
+          unsigned int l0=0)
         : Test("DFS::"+Model::name()+"::"+
                str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
-               str(c_d0)+"::"+str(a_d0)+"::"+str(t0),
-               htb1,htb2,htb3), c_d(c_d0), a_d(a_d0), t(t0) {}
+               str(c_d0)+"::"+str(a_d0)+"::"+str(t0)+
+               ((l0 > 0) ? "::Learn::"+str(l0) : ""),
+               htb1,htb2,htb3), c_d(c_d0), a_d(a_d0), t(t0), l(l0) {}
       /// Run test
       virtual bool run(void) {
         Model* m = new Model(htb1,htb2,htb3);
@@ -380,6 +384,7 @@ namespace Test {
         o.c_d = c_d;
         o.a_d = a_d;
         o.threads = t;
+        o.nogoods_learn = l;
         o.stop = &f;
         Gecode::DFS<Model> dfs(m,o);
         int n = m->solutions();
@@ -444,15 +449,19 @@ namespace Test {
       unsigned int a_d;
       /// Number of threads
       unsigned int t;
+      /// Depth limit for learning no-goods
+      unsigned int l;
     public:
       /// Initialize test
       BAB(HowToConstrain htc,
           HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
-          unsigned int c_d0, unsigned int a_d0, unsigned int t0)
+          unsigned int c_d0, unsigned int a_d0, unsigned int t0,
+          unsigned int l0=0)
         : Test("BAB::"+Model::name()+"::"+str(htc)+"::"+
                str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+
-               str(c_d0)+"::"+str(a_d0)+"::"+str(t0),
-               htb1,htb2,htb3,htc), c_d(c_d0), a_d(a_d0), t(t0) {}
+               str(c_d0)+"::"+str(a_d0)+"::"+str(t0)+
+               ((l0 > 0) ? "::Learn::"+str(l0) : ""),
+               htb1,htb2,htb3,htc), c_d(c_d0), a_d(a_d0), t(t0), l(l0) {}
       /// Run test
       virtual bool run(void) {
         Model* m = new Model(htb1,htb2,htb3,htc);
@@ -461,6 +470,7 @@ namespace Test {
         o.c_d = c_d;
         o.a_d = a_d;
         o.threads = t;
+        o.nogoods_learn = l;
         o.stop = &f;
         Gecode::BAB<Model> bab(m,o);
         delete m;
@@ -723,6 +733,27 @@ namespace Test {
                                     c_d, a_d, t);
             }
 
+        /*
+         * Learned no-goods strengthen propagation, hence they only
+         * preserve the solutions found for complete branchings (that
+         * is, branchings with more than a single alternative).
+         */
+        // Depth-first search with no-good learning
+        for (unsigned int c_d = 1; c_d<10; c_d++)
+          for (unsigned int a_d = 1; a_d<=c_d; a_d++)
+            for (unsigned int l = 2; l<=8; l += 6) {
+              for (BranchTypes htb1; htb1(); ++htb1)
+                for (BranchTypes htb2; htb2(); ++htb2)
+                  for (BranchTypes htb3; htb3(); ++htb3)
+                    if ((htb1.htb() != HTB_UNARY) &&
+                        (htb2.htb() != HTB_UNARY) &&
+                        (htb3.htb() != HTB_UNARY))
+                      (void) new DFS<HasSolutions>
+                        (htb1.htb(),htb2.htb(),htb3.htb(),c_d,a_d,1,l);
+              (void) new DFS<FailImmediate>(HTB_NONE, HTB_NONE, HTB_NONE,
+                                            c_d, a_d, 1, l);
+            }
+
         // Limited discrepancy search
         for (unsigned int t = 1; t<=4; t++) {
           for (BranchTypes htb1; htb1(); ++htb1)
@@ -753,6 +784,23 @@ namespace Test {
               (void) new BAB<HasSolutions>
                 (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,t);
             }
+        // Best solution search with no-good learning
+        for (unsigned int c_d = 1; c_d<10; c_d++)
+          for (unsigned int a_d = 1; a_d<=c_d; a_d++)
+            for (unsigned int l = 2; l<=8; l += 6) {
+              for (ConstrainTypes htc; htc(); ++htc)
+                for (BranchTypes htb1; htb1(); ++htb1)
+                  for (BranchTypes htb2; htb2(); ++htb2)
+                    for (BranchTypes htb3; htb3(); ++htb3)
+                      if ((htb1.htb() != HTB_UNARY) &&
+                          (htb2.htb() != HTB_UNARY) &&
+                          (htb3.htb() != HTB_UNARY))
+                        (void) new BAB<HasSolutions>
+                          (htc.htc(),htb1.htb(),htb2.htb(),htb3.htb(),
+                           c_d,a_d,1,l);
+              (void) new BAB<FailImmediate>
+                (HTC_NONE,HTB_NONE,HTB_NONE,HTB_NONE,c_d,a_d,1,l);
+            }
         // Restart-based search
         for (unsigned int t=1; t<=4; t++) {
           (void) new RBS<HasSolutions,Gecode::DFS>("DFS",t);